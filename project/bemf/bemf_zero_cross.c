@@ -0,0 +1,446 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * bemf_zero_cross.c
+ *
+ * This file implements the BEMF zero crossing commutation. The zero crossing
+ * of the floating phase voltage with respect to half of the DC bus voltage is
+ * detected after a blanking time and the commutation is scheduled 30
+ * electrical degrees after the zero crossing.
+ * While the Hall sensors drive the commutation, the zero crossings are
+ * tracked in parallel and the Hall edges are checked against the predicted
+ * commutation instants.
+ *
+ * Component: BEMF
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "board_service.h"
+#include "bemf_zero_cross.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static void MCAPP_BemfSectorSet(MCAPP_BEMF_T *, uint16_t, uint32_t);
+static void MCAPP_BemfCommutate(MCAPP_BEMF_T *, uint32_t);
+static void MCAPP_BemfZeroCrossDetected(MCAPP_BEMF_T *, uint32_t);
+static void MCAPP_BemfZeroCrossMissed(MCAPP_BEMF_T *);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_BemfZeroCrossInit(&pBemf) </B>
+*
+* @brief Function to reset the run time variables of the BEMF zero crossing
+*        commutation. The loaded sequence and switching arrays are retained.
+*
+* @param Pointer to the data structure containing BEMF parameters.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_BemfZeroCrossInit(&pBemf); </CODE>
+*
+*/
+void MCAPP_BemfZeroCrossInit(MCAPP_BEMF_T *pBemf)
+{
+    pBemf->state            = BEMF_BLANKING;
+    pBemf->sector           = 0;
+    pBemf->bemf             = 0;
+    pBemf->previousBemf     = 0;
+    pBemf->zeroCrossCount   = 0;
+    pBemf->missedCount      = 0;
+    pBemf->mismatchCount    = 0;
+    pBemf->period           = 0;
+    pBemf->timingError      = 0;
+    pBemf->speed            = 0;
+    pBemf->newSample        = 0;
+    pBemf->valid            = 0;
+    pBemf->commutate        = 0;
+    pBemf->failure          = 0;
+}
+
+/**
+* <B> Function: MCAPP_BemfZeroCrossLoad(&pBemf, pSequence, pPwm3State,
+*                                           pPwm2State, pPwm1State) </B>
+*
+* @brief Function to load the commutation order and the inverter switching
+*        arrays obtained from the Hall sequence identifier.
+*
+* @param Pointer to the data structure containing BEMF parameters.
+* @param Hall values in the order of forward rotation (6 values).
+* @param Switching arrays for PWM3, PWM2 and PWM1.
+* @return true if the sequence is a valid Hall sequence, else false.
+*
+* @example
+* <CODE> MCAPP_BemfZeroCrossLoad(&pBemf, sequence, pwm3, pwm2, pwm1); </CODE>
+*
+*/
+bool MCAPP_BemfZeroCrossLoad(MCAPP_BEMF_T *pBemf, const uint16_t *pSequence,
+            uint32_t *pPwm3State, uint32_t *pPwm2State, uint32_t *pPwm1State)
+{
+    uint16_t index, present, next, changedInputs, usedSectors = 0;
+
+    pBemf->enable = 0;
+
+    for(index = 0; index < 8; index++)
+    {
+        pBemf->nextSector[index] = 0;
+        pBemf->previousSector[index] = 0;
+    }
+    for(index = 0; index < 6; index++)
+    {
+        present = pSequence[index];
+        next = pSequence[(index + 1) % 6];
+        /* Each of the Hall values 1 to 6 must be present exactly once */
+        if((present == 0) || (present > 6) || (usedSectors & (1 << present)))
+        {
+            return false;
+        }
+        usedSectors |= (1 << present);
+        /* Consecutive Hall values must differ in exactly one Hall input */
+        changedInputs = present ^ next;
+        if((changedInputs != 1) && (changedInputs != 2) && (changedInputs != 4))
+        {
+            return false;
+        }
+        pBemf->nextSector[present] = next;
+        pBemf->previousSector[next] = present;
+    }
+
+    pBemf->pPwm3State = pPwm3State;
+    pBemf->pPwm2State = pPwm2State;
+    pBemf->pPwm1State = pPwm1State;
+    pBemf->enable = 1;
+
+    return true;
+}
+
+/**
+* <B> Function: MCAPP_BemfZeroCrossUpdate(&pBemf, timeStamp) </B>
+*
+* @brief Function executed every control loop to detect the zero crossing of
+*        the floating phase and to commutate when the BEMF zero crossings
+*        drive the commutation. While the Hall sensors drive the commutation,
+*        the sector follows the Hall sensors and the Hall edge time is
+*        compared with the predicted commutation instant.
+*
+* @param Pointer to the data structure containing BEMF parameters.
+* @param Present time stamp of the speed measurement timer.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_BemfZeroCrossUpdate(&pBemf, timeStamp); </CODE>
+*
+*/
+void MCAPP_BemfZeroCrossUpdate(MCAPP_BEMF_T *pBemf, uint32_t timeStamp)
+{
+    uint16_t appliedSector;
+    uint32_t elapsedTime, blankingTime, zeroCrossTime;
+    int32_t tolerance;
+    int16_t phaseVoltage;
+
+    pBemf->newSample = 0;
+    if(pBemf->enable == 0)
+    {
+        return;
+    }
+
+    if(pBemf->commutate == 0)
+    {
+        /* Hall sensors drive the commutation */
+        appliedSector = *(pBemf->pSector);
+        if(appliedSector != pBemf->sector)
+        {
+            if(pBemf->state == BEMF_COMMUTATION_DELAY)
+            {
+                /* Cross check of the Hall edge with the predicted instant */
+                pBemf->timingError =
+                    (int32_t)(*(pBemf->pHallEdgeTime) - pBemf->commutationDue);
+                tolerance = (int32_t)(pBemf->period * BEMF_CROSSCHECK_TOLERANCE);
+                if((pBemf->timingError > tolerance) ||
+                                            (pBemf->timingError < -tolerance))
+                {
+                    pBemf->mismatchCount++;
+                }
+            }
+            else
+            {
+                /* No zero crossing in the sector left by the Hall sensors */
+                MCAPP_BemfZeroCrossMissed(pBemf);
+            }
+            if((appliedSector > 0) && (appliedSector < 7))
+            {
+                MCAPP_BemfSectorSet(pBemf, appliedSector,
+                                                    *(pBemf->pHallEdgeTime));
+            }
+            return;
+        }
+    }
+
+    /* Floating phase voltage with respect to the star point (Vdc/2), the
+       sign is inverted for a falling BEMF so that the zero crossing is
+       always detected from negative to positive */
+    if(pBemf->floatingPhase == 0)
+    {
+        phaseVoltage = *(pBemf->pVa);
+    }
+    else if(pBemf->floatingPhase == 1)
+    {
+        phaseVoltage = *(pBemf->pVb);
+    }
+    else
+    {
+        phaseVoltage = *(pBemf->pVc);
+    }
+    pBemf->bemf = phaseVoltage - (*(pBemf->pVdc) >> 1);
+    if(pBemf->rising == 0)
+    {
+        pBemf->bemf = -pBemf->bemf;
+    }
+
+    elapsedTime = timeStamp - pBemf->commutationTime;
+
+    switch(pBemf->state)
+    {
+        case BEMF_BLANKING:
+            blankingTime = (uint32_t)(pBemf->period * BEMF_BLANKING_FACTOR);
+            if(blankingTime < pBemf->blankingMin)
+            {
+                blankingTime = pBemf->blankingMin;
+            }
+            if(elapsedTime >= blankingTime)
+            {
+                pBemf->state = BEMF_DETECT;
+            }
+            pBemf->bemf = 0;
+            break;
+
+        case BEMF_DETECT:
+            if(pBemf->bemf >= 0)
+            {
+                /* Interpolate the zero crossing between the two samples */
+                zeroCrossTime = timeStamp;
+                if(pBemf->previousBemf < 0)
+                {
+                    zeroCrossTime -= (uint32_t)((float)pBemf->samplePeriod *
+                        pBemf->bemf / (pBemf->bemf - pBemf->previousBemf));
+                }
+                MCAPP_BemfZeroCrossDetected(pBemf, zeroCrossTime);
+            }
+            else if((pBemf->period != 0) && (elapsedTime > (pBemf->period << 1)))
+            {
+                MCAPP_BemfZeroCrossMissed(pBemf);
+                if(pBemf->commutate == 1)
+                {
+                    /* Commutate without zero crossing to restart detection */
+                    MCAPP_BemfCommutate(pBemf, timeStamp);
+                }
+            }
+            break;
+
+        case BEMF_COMMUTATION_DELAY:
+            if((pBemf->commutate == 1) &&
+                    ((int32_t)(timeStamp - pBemf->commutationDue) >= 0))
+            {
+                MCAPP_BemfCommutate(pBemf, timeStamp);
+            }
+            break;
+
+        default:
+            pBemf->state = BEMF_BLANKING;
+            break;
+    }
+    pBemf->previousBemf = pBemf->bemf;
+}
+
+/**
+* <B> Function: MCAPP_BemfSectorSet(&pBemf, sector, timeStamp) </B>
+*
+* @brief Function to apply a new sector. The floating phase and the polarity
+*        of its zero crossing are taken from the inverter switching arrays of
+*        the present and of the next sector in the direction of rotation.
+*
+* @param Pointer to the data structure containing BEMF parameters.
+* @param New sector (Hall value).
+* @param Time stamp of the commutation.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_BemfSectorSet(&pBemf, sector, timeStamp); </CODE>
+*
+*/
+static void MCAPP_BemfSectorSet(MCAPP_BEMF_T *pBemf, uint16_t sector,
+                                                            uint32_t timeStamp)
+{
+    uint32_t *pState[3];
+    uint16_t phase, next, commutationSector, nextCommutationSector;
+
+    pState[0] = pBemf->pPwm1State;
+    pState[1] = pBemf->pPwm2State;
+    pState[2] = pBemf->pPwm3State;
+
+    /* Reverse direction commutates the sector opposite to the rotor */
+    if(*(pBemf->pDirectionCmd) == 1)
+    {
+        next = pBemf->previousSector[sector];
+        commutationSector = 7 - sector;
+        nextCommutationSector = 7 - next;
+    }
+    else
+    {
+        next = pBemf->nextSector[sector];
+        commutationSector = sector;
+        nextCommutationSector = next;
+    }
+
+    for(phase = 0; phase < 3; phase++)
+    {
+        if(pState[phase][commutationSector] == PWM_OFF)
+        {
+            pBemf->floatingPhase = phase;
+        }
+    }
+    pBemf->rising =
+        (pState[pBemf->floatingPhase][nextCommutationSector] == DC_PLUS);
+
+    pBemf->sector = sector;
+    pBemf->commutationTime = timeStamp;
+    pBemf->previousBemf = 0;
+    pBemf->state = BEMF_BLANKING;
+}
+
+/**
+* <B> Function: MCAPP_BemfCommutate(&pBemf, timeStamp) </B>
+*
+* @brief Function to commutate to the next sector in the direction of
+*        rotation.
+*
+* @param Pointer to the data structure containing BEMF parameters.
+* @param Time stamp of the commutation.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_BemfCommutate(&pBemf, timeStamp); </CODE>
+*
+*/
+static void MCAPP_BemfCommutate(MCAPP_BEMF_T *pBemf, uint32_t timeStamp)
+{
+    if(*(pBemf->pDirectionCmd) == 1)
+    {
+        MCAPP_BemfSectorSet(pBemf, pBemf->previousSector[pBemf->sector],
+                                                                    timeStamp);
+    }
+    else
+    {
+        MCAPP_BemfSectorSet(pBemf, pBemf->nextSector[pBemf->sector], timeStamp);
+    }
+}
+
+/**
+* <B> Function: MCAPP_BemfZeroCrossDetected(&pBemf, zeroCrossTime) </B>
+*
+* @brief Function to update the zero crossing period and speed and to
+*        schedule the commutation after a detected zero crossing.
+*
+* @param Pointer to the data structure containing BEMF parameters.
+* @param Time stamp of the zero crossing.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_BemfZeroCrossDetected(&pBemf, zeroCrossTime); </CODE>
+*
+*/
+static void MCAPP_BemfZeroCrossDetected(MCAPP_BEMF_T *pBemf,
+                                                        uint32_t zeroCrossTime)
+{
+    /* Period is measured only between consecutive zero crossings */
+    if(pBemf->zeroCrossCount > 0)
+    {
+        pBemf->period = zeroCrossTime - pBemf->zeroCrossTime;
+        if(pBemf->period != 0)
+        {
+            pBemf->speed = pBemf->multiplier / pBemf->period;
+            pBemf->newSample = 1;
+        }
+    }
+    pBemf->zeroCrossTime = zeroCrossTime;
+
+    if(pBemf->zeroCrossCount < BEMF_LOCK_COUNT)
+    {
+        pBemf->zeroCrossCount++;
+    }
+    else
+    {
+        pBemf->valid = 1;
+    }
+    pBemf->missedCount = 0;
+
+    pBemf->commutationDue = zeroCrossTime +
+                    (uint32_t)(pBemf->period * BEMF_COMMUTATION_DELAY_FACTOR);
+    pBemf->state = BEMF_COMMUTATION_DELAY;
+}
+
+/**
+* <B> Function: MCAPP_BemfZeroCrossMissed(&pBemf) </B>
+*
+* @brief Function to handle a sector without zero crossing. The lock to the
+*        rotor is lost, if the BEMF zero crossings drive the commutation
+*        consecutive misses raise BEMF failure.
+*
+* @param Pointer to the data structure containing BEMF parameters.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_BemfZeroCrossMissed(&pBemf); </CODE>
+*
+*/
+static void MCAPP_BemfZeroCrossMissed(MCAPP_BEMF_T *pBemf)
+{
+    pBemf->zeroCrossCount = 0;
+
+    if(pBemf->commutate == 1)
+    {
+        pBemf->missedCount++;
+        if(pBemf->missedCount >= BEMF_MISS_LIMIT)
+        {
+            pBemf->failure = 1;
+        }
+    }
+    else
+    {
+        pBemf->valid = 0;
+    }
+}
+
+// </editor-fold>
@@ -0,0 +1,90 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file bemf_zero_cross.h
+ *
+ * @brief This header file lists definitions and interface functions of the
+ * BEMF zero crossing commutation.
+ *
+ * Note : The floating phase and the commutation order are taken from the
+ * inverter switching arrays and the Hall sequence detected by the Hall
+ * sequence identifier. Phase voltages must be sampled during the PWM on time.
+ *
+ * Component: BEMF
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef BEMF_ZERO_CROSS_H
+#define	BEMF_ZERO_CROSS_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "bemf_zero_cross_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Blanking time after commutation as a fraction of the zero crossing period,
+   the floating phase voltage is disturbed by the freewheeling current */
+#define BEMF_BLANKING_FACTOR            0.25f
+/* Delay from zero crossing to commutation as a fraction of the zero crossing
+   period (0.5 = 30 electrical degrees) */
+#define BEMF_COMMUTATION_DELAY_FACTOR   0.5f
+/* Consecutive zero crossings required to lock to the rotor */
+#define BEMF_LOCK_COUNT                 6
+/* Consecutive missed zero crossings which raise BEMF failure */
+#define BEMF_MISS_LIMIT                 3
+/* Tolerance of the Hall edge time against the predicted commutation as a
+   fraction of the zero crossing period */
+#define BEMF_CROSSCHECK_TOLERANCE       0.25f
+/* Minimum blanking time in control loop samples */
+#define BEMF_BLANKING_MIN_SAMPLES       2
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_BemfZeroCrossInit(MCAPP_BEMF_T *);
+bool MCAPP_BemfZeroCrossLoad(MCAPP_BEMF_T *, const uint16_t *, uint32_t *,
+                                                    uint32_t *, uint32_t *);
+void MCAPP_BemfZeroCrossUpdate(MCAPP_BEMF_T *, uint32_t);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* BEMF_ZERO_CROSS_H */
+
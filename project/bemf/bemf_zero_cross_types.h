@@ -0,0 +1,116 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file bemf_zero_cross_types.h
+ *
+ * @brief This module initializes data structure variable type definitions of
+ * BEMF zero crossing commutation structure and enumerations
+ *
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef BEMF_ZERO_CROSS_TYPES_H
+#define	BEMF_ZERO_CROSS_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+#include <stdbool.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="ENUMERATED CONSTANTS ">
+
+typedef enum
+{
+    BEMF_BLANKING = 0,          /* Floating phase ignored after commutation */
+    BEMF_DETECT = 1,            /* Wait for the floating phase zero crossing */
+    BEMF_COMMUTATION_DELAY = 2, /* Wait from zero crossing to commutation */
+
+}MCAPP_BEMF_STATE_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int16_t
+        *pVa,               /* Pointer for A phase terminal voltage */
+        *pVb,               /* Pointer for B phase terminal voltage */
+        *pVc,               /* Pointer for C phase terminal voltage */
+        *pVdc,              /* Pointer for DC bus voltage */
+        bemf,               /* Floating phase voltage w.r.t. Vdc/2 */
+        previousBemf;       /* Floating phase voltage of previous sample */
+    uint16_t
+        *pSector,           /* Pointer for sector applied by Hall sensors */
+        *pDirectionCmd,     /* Pointer for direction command */
+        nextSector[8],      /* Hall value of next sector in sequence order */
+        previousSector[8],  /* Hall value of previous sector */
+        state,              /* State of zero crossing detection */
+        sector,             /* Sector (Hall value) applied to the inverter */
+        floatingPhase,      /* Floating phase: 0 = A, 1 = B, 2 = C */
+        rising,             /* Expected zero crossing polarity */
+        zeroCrossCount,     /* Consecutive detected zero crossings */
+        missedCount,        /* Consecutive missed zero crossings */
+        mismatchCount;      /* Hall edges out of tolerance of prediction */
+    uint32_t
+        *pHallEdgeTime,     /* Pointer for time stamp of last Hall edge */
+        *pPwm1State,        /* Inverter switching array of PWM1 */
+        *pPwm2State,        /* Inverter switching array of PWM2 */
+        *pPwm3State,        /* Inverter switching array of PWM3 */
+        commutationTime,    /* Time stamp of last commutation */
+        zeroCrossTime,      /* Time stamp of last zero crossing */
+        commutationDue,     /* Time stamp of next commutation */
+        period,             /* Zero crossing period (60 electrical degrees) */
+        samplePeriod,       /* Timer counts per control loop */
+        blankingMin;        /* Minimum blanking time in timer counts */
+    int32_t
+        timingError;        /* Hall edge time minus predicted commutation */
+    float
+        multiplier,         /* Speed multiplier */
+        speed;              /* Speed from zero crossing period */
+    bool
+        enable,             /* Sequence and switching arrays are loaded */
+        valid,              /* Zero crossings are locked to the rotor */
+        commutate,          /* BEMF zero crossings drive the commutation */
+        newSample,          /* Speed calculated from a new period in this loop */
+        failure;            /* Zero crossings lost while commutating */
+}MCAPP_BEMF_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* BEMF_ZERO_CROSS_TYPES_H */
+
@@ -0,0 +1,186 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * load_observer.c
+ *
+ * This file implements the load torque observer. The observer state is
+ * integrated every control loop from the motor current and the measured
+ * speed, the estimated load torque is converted to the duty cycle which
+ * drives the load current through the winding resistance.
+ *
+ *
+ * Component: CONTROL ALGORITHIM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "load_observer.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_LoadObserverInit(&pObserver, torqueConstant, inertia,
+*                                           resistance, sampleTime) </B>
+*
+* @brief Function to configure the mechanical model of the load torque
+*        observer. The bandwidth is set by MCAPP_LoadObserverBandwidthSet,
+*        the estimate is not fed forward till enabled.
+*
+* @param Pointer to the data structure containing observer parameters.
+* @param Torque constant (unit : Nm/A).
+* @param Inertia of the rotor and the load (unit : kg.m^2).
+* @param Line to line winding resistance (unit : ohm).
+* @param Time between observer updates (unit : seconds).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_LoadObserverInit(&pObserver, 0.069f, 0.0000071f, 0.57f,
+*                                                           0.00005f); </CODE>
+*
+*/
+void MCAPP_LoadObserverInit(MCAPP_LOAD_OBSERVER_T *pObserver,
+            float torqueConstant, float inertia, float resistance,
+                                                            float sampleTime)
+{
+    pObserver->torqueConstant = torqueConstant;
+    pObserver->inertia = inertia;
+    pObserver->resistance = resistance;
+    pObserver->sampleTime = sampleTime;
+    pObserver->bandwidth = 0;
+    pObserver->gain = 0;
+    pObserver->feedForwardGain = 0;
+    pObserver->enable = 0;
+    MCAPP_LoadObserverReset(pObserver, 0);
+}
+
+/**
+* <B> Function: MCAPP_LoadObserverBandwidthSet(&pObserver, bandwidth) </B>
+*
+* @brief Function to set the observer bandwidth, it can be changed while
+*        the motor runs without a step of the estimate. A higher bandwidth
+*        follows load steps faster and passes more speed measurement noise,
+*        the bandwidth is limited to LOAD_OBSERVER_GAIN_MAX / sampleTime.
+*
+* @param Pointer to the data structure containing observer parameters.
+* @param Observer bandwidth (unit : rad/s).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_LoadObserverBandwidthSet(&pObserver, 50.0f); </CODE>
+*
+*/
+void MCAPP_LoadObserverBandwidthSet(MCAPP_LOAD_OBSERVER_T *pObserver,
+                                                            float bandwidth)
+{
+    pObserver->gain = bandwidth * pObserver->sampleTime;
+    if(pObserver->gain > LOAD_OBSERVER_GAIN_MAX)
+    {
+        pObserver->gain = LOAD_OBSERVER_GAIN_MAX;
+    }
+    else if(pObserver->gain < 0)
+    {
+        pObserver->gain = 0;
+    }
+    pObserver->bandwidth = pObserver->gain / pObserver->sampleTime;
+    pObserver->state = pObserver->torque +
+                pObserver->bandwidth * pObserver->inertia * pObserver->speed;
+}
+
+/**
+* <B> Function: MCAPP_LoadObserverReset(&pObserver, speed) </B>
+*
+* @brief Function to restart the estimate from zero load torque at the
+*        given speed.
+*
+* @param Pointer to the data structure containing observer parameters.
+* @param Measured speed (unit : RPM).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_LoadObserverReset(&pObserver, 0); </CODE>
+*
+*/
+void MCAPP_LoadObserverReset(MCAPP_LOAD_OBSERVER_T *pObserver, float speed)
+{
+    pObserver->speed = speed * LOAD_OBSERVER_RPM_TO_RAD_S;
+    pObserver->state =
+                pObserver->bandwidth * pObserver->inertia * pObserver->speed;
+    pObserver->torque = 0;
+    pObserver->current = 0;
+    pObserver->duty = 0;
+}
+
+/**
+* <B> Function: MCAPP_LoadObserverUpdate(&pObserver, current, speed,
+*                                                           busVoltage) </B>
+*
+* @brief Function executed every control loop to update the load torque
+*        estimate. With the state z = load torque + L x J x w the observer
+*        dz/dt = L x (Kt x I + L x J x w - z) needs no speed derivative. The
+*        duty cycle feed forward drives the current carrying the estimated
+*        load torque through the winding resistance.
+*
+* @param Pointer to the data structure containing observer parameters.
+* @param Motor current (unit : amps).
+* @param Measured speed (unit : RPM).
+* @param DC bus voltage (unit : volts).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_LoadObserverUpdate(&pObserver, current, speed, vdc); </CODE>
+*
+*/
+void MCAPP_LoadObserverUpdate(MCAPP_LOAD_OBSERVER_T *pObserver,
+                                float current, float speed, float busVoltage)
+{
+    float momentum;
+
+    pObserver->speed = speed * LOAD_OBSERVER_RPM_TO_RAD_S;
+    momentum = pObserver->bandwidth * pObserver->inertia * pObserver->speed;
+
+    pObserver->state = pObserver->state + pObserver->gain *
+        (pObserver->torqueConstant * current + momentum - pObserver->state);
+    pObserver->torque = pObserver->state - momentum;
+    pObserver->current = pObserver->torque / pObserver->torqueConstant;
+
+    if((pObserver->enable == 1) && (busVoltage > 1.0f))
+    {
+        pObserver->duty = pObserver->feedForwardGain *
+                    pObserver->resistance * pObserver->current / busVoltage;
+    }
+    else
+    {
+        pObserver->duty = 0;
+    }
+}
+
+// </editor-fold>
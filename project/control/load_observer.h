@@ -0,0 +1,82 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file load_observer.h
+ *
+ * @brief This header file lists interface functions of the load torque
+ * observer.
+ *
+ * Note : The load torque is estimated from the motor current and the
+ * measured speed with the mechanical model J x dw/dt = Kt x I - load torque,
+ * the estimate follows the load torque with a first order lag set by the
+ * observer bandwidth. The speed is not differentiated.
+ *
+ * Component: CONTROL ALGORITHIM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef LOAD_OBSERVER_H
+#define	LOAD_OBSERVER_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "load_observer_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Conversion of RPM to rad/s */
+#define LOAD_OBSERVER_RPM_TO_RAD_S  0.10471976f
+/* Largest observer update gain, bandwidth x sample time, of a stable
+   observer update */
+#define LOAD_OBSERVER_GAIN_MAX      0.5f
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_LoadObserverInit(MCAPP_LOAD_OBSERVER_T *, float, float, float,
+                                                                    float);
+void MCAPP_LoadObserverBandwidthSet(MCAPP_LOAD_OBSERVER_T *, float);
+void MCAPP_LoadObserverReset(MCAPP_LOAD_OBSERVER_T *, float);
+void MCAPP_LoadObserverUpdate(MCAPP_LOAD_OBSERVER_T *, float, float, float);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* LOAD_OBSERVER_H */
+
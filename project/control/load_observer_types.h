@@ -0,0 +1,78 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file load_observer_types.h
+ *
+ * @brief This module initializes data structure variable type definitions of
+ * the load torque observer
+ *
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef LOAD_OBSERVER_TYPES_H
+#define	LOAD_OBSERVER_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+#include <stdbool.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+typedef struct
+{
+    float
+        torqueConstant,     /* Torque per amp of motor current (Nm/A) */
+        inertia,            /* Inertia of the rotor and load (kg.m^2) */
+        resistance,         /* Line to line winding resistance (ohm) */
+        sampleTime,         /* Time between updates (unit : seconds) */
+        bandwidth,          /* Observer bandwidth (unit : rad/s) */
+        gain,               /* Observer update gain, bandwidth x sampleTime */
+        feedForwardGain,    /* Part of the estimate fed forward, 0 to 1 */
+        speed,              /* Mechanical speed (unit : rad/s) */
+        state,              /* Observer state, torque + bandwidth x J x speed */
+        torque,             /* Estimated load torque (unit : Nm) */
+        current,            /* Motor current carrying the load torque (A) */
+        duty;               /* Duty cycle feed forward, 0 to 1 */
+    bool
+        enable;             /* Estimate is fed forward to the speed loop */
+}MCAPP_LOAD_OBSERVER_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* LOAD_OBSERVER_TYPES_H */
+
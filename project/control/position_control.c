@@ -0,0 +1,284 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * position_control.c
+ *
+ * This file implements the Hall count position control. A trapezoidal move
+ * profile is generated from the present position to the target position 
+ * and the rotor follows the profile through the speed controller.
+ *
+ *
+ * Component: CONTROL ALGORITHIM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "position_control.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_PositionControlInit(&pPosition, pOdometer, 
+*                                               countsPerRev, sampleTime) </B>
+*
+* @brief Function to initialize the position control, no move is commanded.
+*
+* @param Pointer to the data structure containing position control 
+*        parameters.
+* @param Pointer for Hall odometer.
+* @param Hall counts per mechanical revolution.
+* @param Time between updates (unit : seconds).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_PositionControlInit(&pPosition, &position, 30, 0.0003f); </CODE>
+*
+*/
+void MCAPP_PositionControlInit(MCAPP_POSITION_CONTROL_T *pPosition,
+                int32_t *pOdometer, uint16_t countsPerRev, float sampleTime)
+{
+    pPosition->pPosition = pOdometer;
+    pPosition->target = *pOdometer;
+    pPosition->error = 0;
+    pPosition->state = POSITION_IDLE;
+    pPosition->direction = 0;
+    pPosition->settleCounter = 0;
+    pPosition->profilePosition = (float)*pOdometer;
+    pPosition->profileSpeed = 0;
+    pPosition->sampleTime = sampleTime;
+    pPosition->countsToRpm = 60.0f / (float)countsPerRev;
+    pPosition->speedCommand = 0;
+}
+
+/**
+* <B> Function: MCAPP_PositionProfileSet(&pPosition, speedMax, accel, kp,
+*                                               window, settleTime) </B>
+*
+* @brief Function to configure the move profile and the position loop.
+*
+* @param Pointer to the data structure containing position control 
+*        parameters.
+* @param Move speed limit (unit : RPM).
+* @param Move acceleration limit (unit : RPM/s).
+* @param Proportional gain (counts/s per count of position error).
+* @param In-position window (unit : Hall counts).
+* @param Updates to settle before an overshoot is corrected.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_PositionProfileSet(&pPosition, 500.0f, 1000.0f, 10.0f, 
+*                                                           1, 600); </CODE>
+*
+*/
+void MCAPP_PositionProfileSet(MCAPP_POSITION_CONTROL_T *pPosition,
+                float speedMax, float accel, float kp, uint16_t window, 
+                                                        uint16_t settleTime)
+{
+    pPosition->speedMax = speedMax / pPosition->countsToRpm;
+    pPosition->accel = accel / pPosition->countsToRpm;
+    pPosition->kp = kp;
+    pPosition->window = window;
+    pPosition->settleTime = settleTime;
+}
+
+/**
+* <B> Function: MCAPP_PositionMoveSet(&pPosition, target) </B>
+*
+* @brief Function to start a move from the present position to the target 
+*        position.
+*
+* @param Pointer to the data structure containing position control 
+*        parameters.
+* @param Target position in Hall counts.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_PositionMoveSet(&pPosition, target); </CODE>
+*
+*/
+void MCAPP_PositionMoveSet(MCAPP_POSITION_CONTROL_T *pPosition, 
+                                                            int32_t target)
+{
+    int32_t position = *pPosition->pPosition;
+    
+    pPosition->target = target;
+    pPosition->direction = (target < position);
+    pPosition->profilePosition = (float)position;
+    pPosition->profileSpeed = 0;
+    pPosition->settleCounter = 0;
+    pPosition->state = POSITION_MOVE;
+}
+
+/**
+* <B> Function: MCAPP_PositionControlUpdate(&pPosition) </B>
+*
+* @brief Function executed at the speed control rate : 
+*        (1) Advance the move profile, the profile decelerates once the 
+*            remaining distance is within the stopping distance
+*        (2) Compute the speed command from the profile speed and the 
+*            position error
+*        (3) Check the rotor is within the in-position window once the 
+*            profile is at the target, an overshoot is corrected by a new 
+*            move after the settle time
+*
+* @param Pointer to the data structure containing position control 
+*        parameters.
+* @return Speed command (unit : RPM).
+*
+* @example
+* <CODE> speedCommand = MCAPP_PositionControlUpdate(&pPosition); </CODE>
+*
+*/
+float MCAPP_PositionControlUpdate(MCAPP_POSITION_CONTROL_T *pPosition)
+{
+    float remaining, stopping, speed;
+    float speedStep = pPosition->accel * pPosition->sampleTime;
+    int32_t position = *pPosition->pPosition;
+    int32_t targetError = pPosition->target - position;
+
+    if((pPosition->state == POSITION_IDLE) || 
+                                    (pPosition->state == POSITION_COMPLETE))
+    {
+        pPosition->speedCommand = 0;
+        return 0;
+    }
+    
+    if(pPosition->state == POSITION_MOVE)
+    {
+        /* Distance to the target along the move direction */
+        remaining = (float)pPosition->target - pPosition->profilePosition;
+        if(pPosition->direction == 1)
+        {
+            remaining = -remaining;
+        }
+        speed = pPosition->profileSpeed;
+        stopping = (speed * speed) / (2 * pPosition->accel);
+        
+        if(((speed * pPosition->sampleTime) >= remaining) ||
+           ((speed <= speedStep) && 
+                        (remaining <= (speedStep * pPosition->sampleTime))))
+        {
+            /* Profile at the target */
+            pPosition->profilePosition = (float)pPosition->target;
+            pPosition->profileSpeed = 0;
+            pPosition->state = POSITION_SETTLE;
+        }
+        else
+        {
+            if(remaining <= stopping)
+            {
+                speed -= speedStep;
+                if(speed < speedStep)
+                {
+                    speed = speedStep;
+                }
+            }
+            else if(speed < pPosition->speedMax)
+            {
+                speed += speedStep;
+                if(speed > pPosition->speedMax)
+                {
+                    speed = pPosition->speedMax;
+                }
+            }
+            pPosition->profileSpeed = speed;
+            if(pPosition->direction == 1)
+            {
+                pPosition->profilePosition -= speed * pPosition->sampleTime;
+            }
+            else
+            {
+                pPosition->profilePosition += speed * pPosition->sampleTime;
+            }
+        }
+    }
+    
+    /* Position error along the move direction, positive while the rotor 
+       lags the profile */
+    pPosition->error = (int32_t)pPosition->profilePosition - position;
+    if(pPosition->direction == 1)
+    {
+        pPosition->error = -pPosition->error;
+    }
+    
+    if(pPosition->state == POSITION_SETTLE)
+    {
+        if((targetError <= (int32_t)pPosition->window) && 
+                                (targetError >= -(int32_t)pPosition->window))
+        {
+            pPosition->state = POSITION_COMPLETE;
+            pPosition->speedCommand = 0;
+            return 0;
+        }
+        pPosition->settleCounter++;
+        if(pPosition->settleCounter >= pPosition->settleTime)
+        {
+            /* Rotor stopped outside the window, move again towards the 
+               target, in the opposite direction after an overshoot */
+            MCAPP_PositionMoveSet(pPosition, pPosition->target);
+        }
+    }
+    
+    /* Speed command, the speed controller can not reverse the motor */
+    speed = pPosition->profileSpeed + (pPosition->kp * (float)pPosition->error);
+    if(speed < 0)
+    {
+        speed = 0;
+    }
+    else if(speed > pPosition->speedMax)
+    {
+        speed = pPosition->speedMax;
+    }
+    pPosition->speedCommand = speed * pPosition->countsToRpm;
+    
+    return pPosition->speedCommand;
+}
+
+/**
+* <B> Function: MCAPP_PositionMoveComplete(&pPosition) </B>
+*
+* @brief Function to read the move status.
+*
+* @param Pointer to the data structure containing position control 
+*        parameters.
+* @return 1 = the rotor is within the in-position window of the target.
+*
+* @example
+* <CODE> MCAPP_PositionMoveComplete(&pPosition); </CODE>
+*
+*/
+bool MCAPP_PositionMoveComplete(MCAPP_POSITION_CONTROL_T *pPosition)
+{
+    return (pPosition->state == POSITION_COMPLETE);
+}
+
+// </editor-fold>
@@ -0,0 +1,77 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file position_control.h
+ *
+ * @brief This header file lists interface functions of the Hall count 
+ * position control.
+ *
+ * Note : The position is the Hall odometer, 6 x POLE_PAIRS counts per 
+ * mechanical revolution. The position loop is cascaded onto the speed loop,
+ * the speed command is the speed of a trapezoidal move profile corrected by
+ * the proportional position error. The speed controller drives the motor in
+ * one direction only, a move is executed in the direction of the target and
+ * an overshoot beyond the in-position window is corrected by a new move in
+ * the opposite direction.
+ *
+ * Component: CONTROL ALGORITHIM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef POSITION_CONTROL_H
+#define	POSITION_CONTROL_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "position_control_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_PositionControlInit(MCAPP_POSITION_CONTROL_T *, int32_t *, 
+                                                            uint16_t, float);
+void MCAPP_PositionProfileSet(MCAPP_POSITION_CONTROL_T *, float, float, 
+                                                    float, uint16_t, uint16_t);
+void MCAPP_PositionMoveSet(MCAPP_POSITION_CONTROL_T *, int32_t);
+float MCAPP_PositionControlUpdate(MCAPP_POSITION_CONTROL_T *);
+bool MCAPP_PositionMoveComplete(MCAPP_POSITION_CONTROL_T *);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* POSITION_CONTROL_H */
+
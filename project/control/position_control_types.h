@@ -0,0 +1,95 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file position_control_types.h
+ *
+ * @brief This module initializes data structure variable type definitions of
+ * the Hall count position control structure and enumerations
+ *
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef POSITION_CONTROL_TYPES_H
+#define	POSITION_CONTROL_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+#include <stdbool.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="ENUMERATED CONSTANTS ">
+
+typedef enum
+{
+    POSITION_IDLE = 0,          /* No move commanded */
+    POSITION_MOVE = 1,          /* Move profile in progress */
+    POSITION_SETTLE = 2,        /* Profile at target, rotor settling */
+    POSITION_COMPLETE = 3,      /* Rotor within the in-position window */
+
+}MCAPP_POSITION_STATE_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int32_t
+        *pPosition,         /* Pointer for Hall odometer */
+        target,             /* Target position in Hall counts */
+        error;              /* Profile position minus rotor position */
+    uint16_t
+        state,              /* Move state, MCAPP_POSITION_STATE_T */
+        direction,          /* Move direction: 0 = forward, 1 = reverse */
+        window,             /* In-position window in Hall counts */
+        settleTime,         /* Updates to settle before the move is retried */
+        settleCounter;      /* Updates since the profile reached the target */
+    float
+        profilePosition,    /* Position of the move profile in Hall counts */
+        profileSpeed,       /* Speed of the move profile (counts/s) */
+        speedMax,           /* Move speed limit (counts/s) */
+        accel,              /* Move acceleration limit (counts/s^2) */
+        kp,                 /* Proportional gain (counts/s per count) */
+        sampleTime,         /* Time between updates (unit : seconds) */
+        countsToRpm,        /* Conversion of counts/s to RPM */
+        speedCommand;       /* Speed command to the speed controller (RPM) */
+}MCAPP_POSITION_CONTROL_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* POSITION_CONTROL_TYPES_H */
+
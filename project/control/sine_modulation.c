@@ -0,0 +1,258 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * sine_modulation.c
+ *
+ * This file implements the sinusoidal commutation. The PWM duties of the
+ * three phases are computed from the interpolated rotor angle and the duty
+ * command of the control loops, with optional min-max (space vector)
+ * zero sequence injection.
+ *
+ *
+ * Component: CONTROL ALGORITHIM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sine_modulation.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Global Variables  ">
+
+/* One period of sine, indexed by the upper bits of the 16 bit angle */
+static const float sineTable[SINE_TABLE_SIZE] =
+{
+     0.000000f,  0.024541f,  0.049068f,  0.073565f,  0.098017f,  0.122411f,
+     0.146730f,  0.170962f,  0.195090f,  0.219101f,  0.242980f,  0.266713f,
+     0.290285f,  0.313682f,  0.336890f,  0.359895f,  0.382683f,  0.405241f,
+     0.427555f,  0.449611f,  0.471397f,  0.492898f,  0.514103f,  0.534998f,
+     0.555570f,  0.575808f,  0.595699f,  0.615232f,  0.634393f,  0.653173f,
+     0.671559f,  0.689541f,  0.707107f,  0.724247f,  0.740951f,  0.757209f,
+     0.773010f,  0.788346f,  0.803208f,  0.817585f,  0.831470f,  0.844854f,
+     0.857729f,  0.870087f,  0.881921f,  0.893224f,  0.903989f,  0.914210f,
+     0.923880f,  0.932993f,  0.941544f,  0.949528f,  0.956940f,  0.963776f,
+     0.970031f,  0.975702f,  0.980785f,  0.985278f,  0.989177f,  0.992480f,
+     0.995185f,  0.997290f,  0.998795f,  0.999699f,  1.000000f,  0.999699f,
+     0.998795f,  0.997290f,  0.995185f,  0.992480f,  0.989177f,  0.985278f,
+     0.980785f,  0.975702f,  0.970031f,  0.963776f,  0.956940f,  0.949528f,
+     0.941544f,  0.932993f,  0.923880f,  0.914210f,  0.903989f,  0.893224f,
+     0.881921f,  0.870087f,  0.857729f,  0.844854f,  0.831470f,  0.817585f,
+     0.803208f,  0.788346f,  0.773010f,  0.757209f,  0.740951f,  0.724247f,
+     0.707107f,  0.689541f,  0.671559f,  0.653173f,  0.634393f,  0.615232f,
+     0.595699f,  0.575808f,  0.555570f,  0.534998f,  0.514103f,  0.492898f,
+     0.471397f,  0.449611f,  0.427555f,  0.405241f,  0.382683f,  0.359895f,
+     0.336890f,  0.313682f,  0.290285f,  0.266713f,  0.242980f,  0.219101f,
+     0.195090f,  0.170962f,  0.146730f,  0.122411f,  0.098017f,  0.073565f,
+     0.049068f,  0.024541f,  0.000000f, -0.024541f, -0.049068f, -0.073565f,
+    -0.098017f, -0.122411f, -0.146730f, -0.170962f, -0.195090f, -0.219101f,
+    -0.242980f, -0.266713f, -0.290285f, -0.313682f, -0.336890f, -0.359895f,
+    -0.382683f, -0.405241f, -0.427555f, -0.449611f, -0.471397f, -0.492898f,
+    -0.514103f, -0.534998f, -0.555570f, -0.575808f, -0.595699f, -0.615232f,
+    -0.634393f, -0.653173f, -0.671559f, -0.689541f, -0.707107f, -0.724247f,
+    -0.740951f, -0.757209f, -0.773010f, -0.788346f, -0.803208f, -0.817585f,
+    -0.831470f, -0.844854f, -0.857729f, -0.870087f, -0.881921f, -0.893224f,
+    -0.903989f, -0.914210f, -0.923880f, -0.932993f, -0.941544f, -0.949528f,
+    -0.956940f, -0.963776f, -0.970031f, -0.975702f, -0.980785f, -0.985278f,
+    -0.989177f, -0.992480f, -0.995185f, -0.997290f, -0.998795f, -0.999699f,
+    -1.000000f, -0.999699f, -0.998795f, -0.997290f, -0.995185f, -0.992480f,
+    -0.989177f, -0.985278f, -0.980785f, -0.975702f, -0.970031f, -0.963776f,
+    -0.956940f, -0.949528f, -0.941544f, -0.932993f, -0.923880f, -0.914210f,
+    -0.903989f, -0.893224f, -0.881921f, -0.870087f, -0.857729f, -0.844854f,
+    -0.831470f, -0.817585f, -0.803208f, -0.788346f, -0.773010f, -0.757209f,
+    -0.740951f, -0.724247f, -0.707107f, -0.689541f, -0.671559f, -0.653173f,
+    -0.634393f, -0.615232f, -0.595699f, -0.575808f, -0.555570f, -0.534998f,
+    -0.514103f, -0.492898f, -0.471397f, -0.449611f, -0.427555f, -0.405241f,
+    -0.382683f, -0.359895f, -0.336890f, -0.313682f, -0.290285f, -0.266713f,
+    -0.242980f, -0.219101f, -0.195090f, -0.170962f, -0.146730f, -0.122411f,
+    -0.098017f, -0.073565f, -0.049068f, -0.024541f
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_SineModulationInit(&pSine, mode, entrySpeed, 
+*                                                               exitSpeed) </B>
+*
+* @brief Function to configure the sinusoidal commutation.
+*
+* @param Pointer to the data structure containing sinusoidal commutation 
+*        parameters.
+* @param Commutation mode (SIX_STEP_COMMUTATION = disabled).
+* @param Speed above which the sinusoidal duties are used.
+* @param Speed below which six-step commutation is used again.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_SineModulationInit(&pSine, SINE_COMMUTATION, 300.0f, 
+*                                                               250.0f); </CODE>
+*
+*/
+void MCAPP_SineModulationInit(MCAPP_SINE_MODULATION_T *pSine, uint16_t mode,
+                                            float entrySpeed, float exitSpeed)
+{
+    pSine->mode = mode;
+    pSine->entrySpeed = entrySpeed;
+    /* Exit speed above entry speed would toggle the commutation mode */
+    if(exitSpeed > entrySpeed)
+    {
+        exitSpeed = entrySpeed;
+    }
+    pSine->exitSpeed = exitSpeed;
+    pSine->angle = 0;
+    pSine->duty[0] = 0;
+    pSine->duty[1] = 0;
+    pSine->duty[2] = 0;
+    pSine->modulationIndex = 0;
+    pSine->active = 0;
+}
+
+/**
+* <B> Function: MCAPP_SineModulationSelect(&pSine, speed) </B>
+*
+* @brief Function to select between six-step and sinusoidal commutation. The
+*        sinusoidal duties are used above the entry speed and as long as the
+*        rotor angle is valid, six-step commutation is used again below the 
+*        exit speed.
+*
+* @param Pointer to the data structure containing sinusoidal commutation 
+*        parameters.
+* @param Measured speed.
+* @return Sinusoidal commutation requested.
+*
+* @example
+* <CODE> sineRequest = MCAPP_SineModulationSelect(&pSine, speed); </CODE>
+*
+*/
+bool MCAPP_SineModulationSelect(MCAPP_SINE_MODULATION_T *pSine, float speed)
+{
+    if((pSine->mode == SIX_STEP_COMMUTATION) || (*(pSine->pAngleValid) == 0))
+    {
+        return 0;
+    }
+    if(pSine->active == 1)
+    {
+        return (speed >= pSine->exitSpeed);
+    }
+    return (speed >= pSine->entrySpeed);
+}
+
+/**
+* <B> Function: MCAPP_SineModulationUpdate(&pSine, directionCmd, pwmDuty,
+*                                                               pwmPeriod) </B>
+*
+* @brief Function executed every control loop to compute the PWM duties of 
+*        the three phases. The duty command of the control loops sets the 
+*        line voltage amplitude, so that the same duty command applies about 
+*        the same voltage in six-step and sinusoidal commutation.
+*
+* @param Pointer to the data structure containing sinusoidal commutation 
+*        parameters.
+* @param Direction command (0 = sequence order, 1 = reverse order).
+* @param Duty command.
+* @param PWM period.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_SineModulationUpdate(&pSine, directionCmd, pwmDuty, 
+*                                                           pwmPeriod); </CODE>
+*
+*/
+void MCAPP_SineModulationUpdate(MCAPP_SINE_MODULATION_T *pSine,
+                    uint16_t directionCmd, uint32_t pwmDuty, uint32_t pwmPeriod)
+{
+    uint16_t torqueAngle, phase;
+    float amplitude, vPhase[3], vmax, vmin, offset, duty;
+
+    pSine->modulationIndex = (float)pwmDuty / (float)pwmPeriod;
+    if(pSine->modulationIndex > 1.0f)
+    {
+        pSine->modulationIndex = 1.0f;
+    }
+    amplitude = pSine->modulationIndex * SINE_PHASE_AMPLITUDE;
+
+    /* Voltage vector 90 degrees plus the advance angle ahead of the rotor */
+    torqueAngle = SINE_ANGLE_90DEG +
+                (uint16_t)(*(pSine->pAdvanceAngle) * SINE_ANGLE_PER_DEG);
+    if(directionCmd == 1)
+    {
+        pSine->angle = *(pSine->pAngle) - torqueAngle;
+    }
+    else
+    {
+        pSine->angle = *(pSine->pAngle) + torqueAngle;
+    }
+
+    /* PWM1, PWM2 and PWM3 are the phases at 0, 120 and 240 degrees */
+    vPhase[0] = amplitude * sineTable[pSine->angle >> SINE_TABLE_SHIFT];
+    vPhase[1] = amplitude * sineTable[(uint16_t)(pSine->angle - 
+                                    SINE_ANGLE_120DEG) >> SINE_TABLE_SHIFT];
+    vPhase[2] = amplitude * sineTable[(uint16_t)(pSine->angle + 
+                                    SINE_ANGLE_120DEG) >> SINE_TABLE_SHIFT];
+
+    offset = 0.5f;
+    if(pSine->mode == SPACE_VECTOR_COMMUTATION)
+    {
+        /* Min-max injection centres the phase voltages within the DC bus */
+        vmax = vPhase[0];
+        vmin = vPhase[0];
+        for(phase = 1; phase < 3; phase++)
+        {
+            if(vPhase[phase] > vmax)
+            {
+                vmax = vPhase[phase];
+            }
+            if(vPhase[phase] < vmin)
+            {
+                vmin = vPhase[phase];
+            }
+        }
+        offset = 0.5f - (0.5f * (vmax + vmin));
+    }
+
+    for(phase = 0; phase < 3; phase++)
+    {
+        /* Sinusoidal duties are clipped on over modulation */
+        duty = offset + vPhase[phase];
+        if(duty < 0.0f)
+        {
+            duty = 0.0f;
+        }
+        if(duty > 1.0f)
+        {
+            duty = 1.0f;
+        }
+        pSine->duty[phase] = (uint32_t)((float)pwmPeriod * duty);
+    }
+}
+
+// </editor-fold>
@@ -0,0 +1,87 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file sine_modulation.h
+ *
+ * @brief This header file lists definitions and interface functions of the
+ * sinusoidal commutation.
+ *
+ * Note : The voltage vector is placed 90 electrical degrees (plus the phase
+ * advance angle) ahead of the rotor angle interpolated between Hall edges.
+ * The PWM generators must operate in complementary mode with the override
+ * disabled while the sinusoidal duties are applied.
+ *
+ * Component: CONTROL ALGORITHIM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef SINE_MODULATION_H
+#define	SINE_MODULATION_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sine_modulation_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Number of entries of the sine table (must be a power of 2) */
+#define SINE_TABLE_SIZE             256
+#define SINE_TABLE_SHIFT            8
+/* 90 and 120 electrical degrees in 16 bit angle representation */
+#define SINE_ANGLE_90DEG            16384
+#define SINE_ANGLE_120DEG           21845
+/* Conversion of electrical degrees to 16 bit angle representation */
+#define SINE_ANGLE_PER_DEG          182.044f
+/* Phase voltage amplitude per unit line voltage amplitude (1/sqrt(3)) */
+#define SINE_PHASE_AMPLITUDE        0.57735f
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_SineModulationInit(MCAPP_SINE_MODULATION_T *, uint16_t,
+                                                            float, float);
+bool MCAPP_SineModulationSelect(MCAPP_SINE_MODULATION_T *, float);
+void MCAPP_SineModulationUpdate(MCAPP_SINE_MODULATION_T *, uint16_t,
+                                                        uint32_t, uint32_t);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* SINE_MODULATION_H */
+
@@ -0,0 +1,89 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file sine_modulation_types.h
+ *
+ * @brief This module initializes data structure variable type definitions of
+ * sinusoidal commutation structure and enumerations
+ *
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef SINE_MODULATION_TYPES_H
+#define	SINE_MODULATION_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+#include <stdbool.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="ENUMERATED CONSTANTS ">
+
+typedef enum
+{
+    SIX_STEP_COMMUTATION = 0,   /* Override based six-step commutation only */
+    SINE_COMMUTATION = 1,       /* Sinusoidal phase duties */
+    SPACE_VECTOR_COMMUTATION = 2, /* Sinusoidal duties with min-max injection */
+
+}MCAPP_COMMUTATION_MODE_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+typedef struct
+{
+    uint16_t
+        *pAngle,            /* Pointer for interpolated rotor angle */
+        mode,               /* Commutation mode, MCAPP_COMMUTATION_MODE_T */
+        angle;              /* Voltage vector angle, 65536 = 360 degrees */
+    uint32_t
+        duty[3];            /* PWM duty of PWM1, PWM2 and PWM3 */
+    float
+        *pAdvanceAngle,     /* Pointer for commutation advance angle */
+        entrySpeed,         /* Speed above which sinusoidal duties are used */
+        exitSpeed,          /* Speed below which six-step is used again */
+        modulationIndex;    /* Line voltage amplitude relative to Vdc */
+    bool
+        *pAngleValid,       /* Pointer for rotor angle valid flag */
+        active;             /* Sinusoidal duties drive the inverter */
+}MCAPP_SINE_MODULATION_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* SINE_MODULATION_TYPES_H */
+
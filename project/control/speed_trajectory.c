@@ -0,0 +1,235 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * speed_trajectory.c
+ *
+ * This file implements the speed trajectory generator between the speed 
+ * command and the speed controller. The acceleration of the reference is 
+ * limited and changes at the jerk limit, every update executes in constant 
+ * time.
+ *
+ *
+ * Component: CONTROL ALGORITHIM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "speed_trajectory.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_SpeedTrajectoryInit(&pTrajectory, accelMax, jerk, 
+*                                                           sampleTime) </B>
+*
+* @brief Function to configure the limits of the speed trajectory generator.
+*
+* @param Pointer to the data structure containing trajectory parameters.
+* @param Acceleration limit (unit : RPM/s).
+* @param Jerk limit (unit : RPM/s^2).
+* @param Time between trajectory updates (unit : seconds).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_SpeedTrajectoryInit(&pTrajectory, 2500.0f, 10000.0f, 
+*                                                           0.0003f); </CODE>
+*
+*/
+void MCAPP_SpeedTrajectoryInit(MCAPP_SPEED_TRAJECTORY_T *pTrajectory,
+                                float accelMax, float jerk, float sampleTime)
+{
+    pTrajectory->accelMax = accelMax;
+    pTrajectory->jerk = jerk;
+    pTrajectory->sampleTime = sampleTime;
+    pTrajectory->jerkStep = jerk * sampleTime;
+    MCAPP_SpeedTrajectoryReset(pTrajectory, 0);
+}
+
+/**
+* <B> Function: MCAPP_SpeedTrajectoryReset(&pTrajectory, speed) </B>
+*
+* @brief Function to hold the speed reference at the given speed, any 
+*        commanded profile is cancelled.
+*
+* @param Pointer to the data structure containing trajectory parameters.
+* @param Speed to start the trajectory from (unit : RPM).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_SpeedTrajectoryReset(&pTrajectory, speed); </CODE>
+*
+*/
+void MCAPP_SpeedTrajectoryReset(MCAPP_SPEED_TRAJECTORY_T *pTrajectory,
+                                                                float speed)
+{
+    pTrajectory->target = speed;
+    pTrajectory->reference = speed;
+    pTrajectory->acceleration = 0;
+    pTrajectory->accelLimit = pTrajectory->accelMax;
+    pTrajectory->profile = 0;
+}
+
+/**
+* <B> Function: MCAPP_SpeedTrajectoryTargetSet(&pTrajectory, target) </B>
+*
+* @brief Function to command the speed from the control input, the speed 
+*        is approached at the acceleration limit. The command is ignored 
+*        while a commanded profile is in progress.
+*
+* @param Pointer to the data structure containing trajectory parameters.
+* @param Commanded speed (unit : RPM).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_SpeedTrajectoryTargetSet(&pTrajectory, target); </CODE>
+*
+*/
+void MCAPP_SpeedTrajectoryTargetSet(MCAPP_SPEED_TRAJECTORY_T *pTrajectory,
+                                                                float target)
+{
+    if(pTrajectory->profile == 0)
+    {
+        pTrajectory->target = target;
+        pTrajectory->accelLimit = pTrajectory->accelMax;
+    }
+}
+
+/**
+* <B> Function: MCAPP_SpeedTrajectoryProfileSet(&pTrajectory, target, 
+*                                                               time) </B>
+*
+* @brief Function to command a profile reaching the target speed in the 
+*        given time. The acceleration A of the profile satisfies 
+*        speed change = A x (time - A / jerk), for a profile starting and 
+*        ending at zero acceleration. A profile faster than the limits allow
+*        is executed at the acceleration and jerk limits.
+*
+* @param Pointer to the data structure containing trajectory parameters.
+* @param Target speed (unit : RPM).
+* @param Time to reach the target speed (unit : milli seconds).
+* @return 1 = the target speed is reached in time, 0 = limits exceeded.
+*
+* @example
+* <CODE> MCAPP_SpeedTrajectoryProfileSet(&pTrajectory, 1000.0f, 500); </CODE>
+*
+*/
+bool MCAPP_SpeedTrajectoryProfileSet(MCAPP_SPEED_TRAJECTORY_T *pTrajectory,
+                                                float target, uint16_t time)
+{
+    float speedChange, profileTime, discriminant, accel;
+    bool inTime = 0;
+
+    speedChange = fabsf(target - pTrajectory->reference);
+    profileTime = (float)time * 0.001f;
+    discriminant = (profileTime * profileTime) - 
+                                    (4.0f * speedChange / pTrajectory->jerk);
+    accel = pTrajectory->accelMax;
+    if(discriminant >= 0)
+    {
+        accel = 0.5f * pTrajectory->jerk * (profileTime - sqrtf(discriminant));
+        inTime = (accel <= pTrajectory->accelMax);
+    }
+    if((accel <= 0) || (accel > pTrajectory->accelMax))
+    {
+        accel = pTrajectory->accelMax;
+    }
+
+    pTrajectory->accelLimit = accel;
+    pTrajectory->target = target;
+    pTrajectory->profile = 1;
+
+    return inTime;
+}
+
+/**
+* <B> Function: MCAPP_SpeedTrajectoryUpdate(&pTrajectory) </B>
+*
+* @brief Function executed at the speed control rate to move the speed 
+*        reference towards the target speed. The acceleration is steered 
+*        towards the acceleration limit, or towards the opposite limit once
+*        the speed change while the acceleration decays to zero at the jerk 
+*        limit reaches the remaining speed error.
+*
+* @param Pointer to the data structure containing trajectory parameters.
+* @return Speed reference (unit : RPM).
+*
+* @example
+* <CODE> speedReference = MCAPP_SpeedTrajectoryUpdate(&pTrajectory); </CODE>
+*
+*/
+float MCAPP_SpeedTrajectoryUpdate(MCAPP_SPEED_TRAJECTORY_T *pTrajectory)
+{
+    float error, accel, braking, accelCmd, accelChange;
+    float sampleTime = pTrajectory->sampleTime;
+    float jerkStep = pTrajectory->jerkStep;
+
+    error = pTrajectory->target - pTrajectory->reference;
+    accel = pTrajectory->acceleration;
+
+    /* Target reached within one update at the end of the S-curve */
+    if((fabsf(error) <= ((fabsf(accel) + jerkStep) * sampleTime)) && 
+                                            (fabsf(accel) <= (2 * jerkStep)))
+    {
+        pTrajectory->reference = pTrajectory->target;
+        pTrajectory->acceleration = 0;
+        pTrajectory->profile = 0;
+        return pTrajectory->reference;
+    }
+
+    /* Speed change while the acceleration decays to zero */
+    braking = (accel * fabsf(accel)) / (2 * pTrajectory->jerk);
+    if((error - braking) > 0)
+    {
+        accelCmd = pTrajectory->accelLimit;
+    }
+    else
+    {
+        accelCmd = -pTrajectory->accelLimit;
+    }
+
+    accelChange = accelCmd - accel;
+    if(accelChange > jerkStep)
+    {
+        accelChange = jerkStep;
+    }
+    else if(accelChange < -jerkStep)
+    {
+        accelChange = -jerkStep;
+    }
+    pTrajectory->acceleration = accel + accelChange;
+    pTrajectory->reference += pTrajectory->acceleration * sampleTime;
+
+    return pTrajectory->reference;
+}
+
+// </editor-fold>
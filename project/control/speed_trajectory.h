@@ -0,0 +1,72 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file speed_trajectory.h
+ *
+ * @brief This header file lists interface functions of the speed trajectory 
+ * generator.
+ *
+ * Note : The speed reference follows the commanded speed with limited 
+ * acceleration and jerk (S-curve), the acceleration is decreased early 
+ * enough to reach the commanded speed without overshoot.
+ *
+ * Component: CONTROL ALGORITHIM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef SPEED_TRAJECTORY_H
+#define	SPEED_TRAJECTORY_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "speed_trajectory_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_SpeedTrajectoryInit(MCAPP_SPEED_TRAJECTORY_T *, float, float, float);
+void MCAPP_SpeedTrajectoryReset(MCAPP_SPEED_TRAJECTORY_T *, float);
+void MCAPP_SpeedTrajectoryTargetSet(MCAPP_SPEED_TRAJECTORY_T *, float);
+bool MCAPP_SpeedTrajectoryProfileSet(MCAPP_SPEED_TRAJECTORY_T *, float, 
+                                                                uint16_t);
+float MCAPP_SpeedTrajectoryUpdate(MCAPP_SPEED_TRAJECTORY_T *);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* SPEED_TRAJECTORY_H */
+
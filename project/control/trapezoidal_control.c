@@ -41,20 +41,19 @@
 #include <stdbool.h>
 #include "board_service.h"
 #include "trapezoidal_control.h"
-
-// </editor-fold>
-
-// <editor-fold defaultstate="collapsed" desc="Global Variables  ">
-/* Pointers to PWM states for inverter switching arrays */
-uint32_t *PWM1_STATE;
-uint32_t *PWM2_STATE;
-uint32_t *PWM3_STATE;
+#include "sine_modulation.h"
+#include "speed_trajectory.h"
+#include "position_control.h"
+#include "load_observer.h"
 
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
 static void MCAPP_GetControlInputs(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *);
-static void MCAPP_PWM_Override (uint16_t );
+static void MCAPP_PWM_Override(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *, uint16_t);
+static void MCAPP_CommutationOutput(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *);
+static bool MCAPP_SpeedLoopDue(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *, bool);
+static void MCAPP_SpeedControllerUpdate(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *);
 
 // </editor-fold>
 
@@ -89,12 +88,30 @@ void MCAPP_TrapezoidalControlInit(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pTrapezoidal
     pTrapezoidalControl->measuredSpeed              = 0;
     pTrapezoidalControl->pwmDuty                    = 0;
     pTrapezoidalControl->sector                     = 0;
+    /* The outputs are driven by the application till the first commutation,
+       the commutation word and the duty are written on the first loop */
+    pTrapezoidalControl->appliedWord                = PWM_COMMUTATION_WORD_NONE;
+    pTrapezoidalControl->appliedDuty                = PWM_DUTY_NONE;
 
     pTrapezoidalControl->ctrlParam.targetCurrent    = 0;
     pTrapezoidalControl->ctrlParam.targetDuty       = 0;
     pTrapezoidalControl->ctrlParam.targetSpeed      = 0;
+    pTrapezoidalControl->speedLoop.elapsed          = 0;
+    MCAPP_LoadObserverReset(&pTrapezoidalControl->loadObserver, 0);
+    /* The speed reference starts from standstill */
+    MCAPP_SpeedTrajectoryReset(&pTrapezoidalControl->speedTrajectory, 0);
 
     pTrapezoidalControl->controlState = CONTROL_LOOP; 
+    /* Start with six-step commutation, the PWM Generators are returned to 
+       independent mode. This runs in the control loop interrupt, the update
+       of the override is not waited for : while it is pending the mode is
+       left complementary and the control loop completes the change. */
+    if((pTrapezoidalControl->complementaryMode == 1) &&
+        (HAL_PWMComplementaryModeSet(pTrapezoidalControl->pHal, 0) == 1))
+    {
+        pTrapezoidalControl->complementaryMode = 0;
+    }
+    pTrapezoidalControl->sine.active = 0;
 }
 
 
@@ -113,10 +130,12 @@ static void MCAPP_GetControlInputs(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pControl)
 { 
     MCAPP_MOTOR_T *pMotor = &pControl->motor;
     
-    /* Motor current inputs */
-    pControl->sector = *(pControl->pSector);
-    pControl->measuredSpeed = *(pControl->pMeasuredSpeed);
-    pControl->directionCmd  = *(pControl->pDirectionCmd);
+    /* The sector, speed, direction command, current and bus voltage are 
+       written to the hot fields by the application before the control loop */
+    
+    /* Load torque estimate, fed forward to the speed loop if enabled */
+    MCAPP_LoadObserverUpdate(&pControl->loadObserver, pControl->avgCurrent,
+                            pControl->measuredSpeed, pControl->busVoltage);
     
     if(pControl->directionCmd == 1)
     {
@@ -133,14 +152,14 @@ static void MCAPP_GetControlInputs(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pControl)
        pControl->ctrlParam.targetSpeed = pMotor->MinSpeed + 
             (((pMotor->MaxSpeed - pMotor->MinSpeed) * 
                pControl->ctrlParam.controlInput)/MAX_ADC_COUNT);
+       MCAPP_SpeedTrajectoryTargetSet(&pControl->speedTrajectory, 
+                                            pControl->ctrlParam.targetSpeed);
     }
     if(pControl->ctrlParam.controlLoop == CURRENT_CONTROL)
     {
         /* Current Input from control input for current control */
         pControl->ctrlParam.targetCurrent = pMotor->RatedCurrent *
                 (pControl->ctrlParam.controlInput/MAX_ADC_COUNT);
-        /* Measured filtered bus current */
-        pControl->avgCurrent = *(pControl->pAvgCurrent); 
     } 
 }
 
@@ -159,6 +178,7 @@ static void MCAPP_GetControlInputs(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pControl)
 void MCAPP_TrapezoidalControlStateMachine(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pControl)
 {    
     MCAPP_CONTROL_T *pCtrlParam = &pControl->ctrlParam;
+    bool rateDue;
     
     switch (pControl->controlState)
     {
@@ -177,43 +197,71 @@ void MCAPP_TrapezoidalControlStateMachine(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pCon
             {
                 pControl->controlState = SPEED_CONTROL_LOOP;
             }
+            else if( pCtrlParam->controlLoop == POSITION_CONTROL )
+            {
+                pControl->controlState = POSITION_CONTROL_LOOP;
+            }
             else
                 pControl->controlState = CONTROL_OPEN_LOOP;
             break;
         
         case CONTROL_OPEN_LOOP:
             MCAPP_GetControlInputs(pControl);
-            MCAPP_PWM_Override(pControl->commutationSector);
             pControl->ctrlParam.targetDuty = 
                     ((float)(pControl->ctrlParam.controlInput *         
                                 pControl->pwmPeriod)/MAX_ADC_COUNT);
                     
             pControl->pwmDuty = (uint32_t) pControl->ctrlParam.targetDuty;
+            MCAPP_CommutationOutput(pControl);
             
             break;  
           
         case SPEED_CONTROL_LOOP:
+            /* Commutate every control loop, the speed reference is updated 
+               at the reduced rate */
+            MCAPP_GetControlInputs(pControl);
+            rateDue = (pControl->controlLoopRateCounter > 
+                                                pControl->controlLoopRate);
+            if(rateDue == 1)
+            {
+                /* The speed reference follows the target speed with limited
+                   acceleration and jerk */
+                pControl->piSpeed.inReference = 
+                    MCAPP_SpeedTrajectoryUpdate(&pControl->speedTrajectory);
+                pControl->controlLoopRateCounter = 0;
+            }
+            else
+            {
+                pControl->controlLoopRateCounter++;
+            }
+            if(MCAPP_SpeedLoopDue(pControl, rateDue) == 1)
+            {
+                MCAPP_SpeedControllerUpdate(pControl);
+            }
+            MCAPP_CommutationOutput(pControl);
+            break;
+            
+        case POSITION_CONTROL_LOOP:
+            /* Position loop cascaded onto the speed loop, both executed at
+               the reduced rate */
+            MCAPP_GetControlInputs(pControl);
             if(pControl->controlLoopRateCounter > pControl->controlLoopRate)
             {
-                MCAPP_GetControlInputs(pControl);
-                MCAPP_PWM_Override(pControl->commutationSector);
-                /* PI control in Speed Loop */
+                pControl->ctrlParam.targetSpeed = 
+                        MCAPP_PositionControlUpdate(&pControl->position);
                 pControl->piSpeed.inReference = pControl->ctrlParam.targetSpeed;
-                pControl->piSpeed.inMeasure   = pControl->measuredSpeed;
-                MC_ControllerPIUpdate(&pControl->piSpeed);
-                pControl->pwmDuty = (uint32_t) ((float)(pControl->piSpeed.output * 
-                                                            pControl->pwmPeriod)); 
+                MCAPP_SpeedControllerUpdate(pControl);
                 pControl->controlLoopRateCounter = 0;
             }
             else
             {
                 pControl->controlLoopRateCounter++;
             }
+            MCAPP_CommutationOutput(pControl);
             break;
             
         case CURRENT_CONTROL_LOOP:
             MCAPP_GetControlInputs(pControl);
-            MCAPP_PWM_Override(pControl->commutationSector);
             
             /* PI control in Current Loop */
             pControl->piCurrent.inReference = pControl->ctrlParam.targetCurrent;
@@ -221,6 +269,7 @@ void MCAPP_TrapezoidalControlStateMachine(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pCon
             MC_ControllerPIUpdate(&pControl->piCurrent);
             pControl->pwmDuty = (uint32_t) ((float)(pControl->piCurrent.output * 
                                                         pControl->pwmPeriod)); 
+            MCAPP_CommutationOutput(pControl);
             
             break;
 
@@ -235,38 +284,223 @@ void MCAPP_TrapezoidalControlStateMachine(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pCon
     } /* End Of switch - case */
 }
 
+/**
+* <B> Function: bool MCAPP_SpeedLoopDue (MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *, 
+*                                                               bool)  </B>
+*
+* @brief Function to decide the execution of the speed controller. At fixed
+*        rate it is executed with the speed reference update. Event triggered
+*        it is executed when a new speed measurement is available, or after
+*        the timeout without new measurement (stall), the integral gain is 
+*        scaled by the control loops elapsed since the last execution.
+*
+* @param Pointer to the data structure containing control parameters.
+* @param The speed reference is updated in this control loop.
+* @return Speed controller to be executed in this control loop.
+* @example
+* <CODE> due = MCAPP_SpeedLoopDue(&pControl, rateDue); </CODE>
+*
+*/
+static bool MCAPP_SpeedLoopDue(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pControl,
+                                                                bool rateDue)
+{
+    MCAPP_SPEED_LOOP_T *pLoop = &pControl->speedLoop;
+    
+    if(pLoop->mode == SPEED_LOOP_FIXED_RATE)
+    {
+        return rateDue;
+    }
+    
+    pLoop->elapsed++;
+    if((pControl->speedSample == 0) && (pLoop->elapsed < pLoop->timeout))
+    {
+        return 0;
+    }
+    pControl->piSpeed.param.ki = pLoop->kiPerLoop * (float)pLoop->elapsed;
+    pLoop->elapsed = 0;
+    return 1;
+}
+
+/**
+* <B> Function: void MCAPP_SpeedControllerUpdate (
+*                                   MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *)  </B>
+*
+* @brief Function to execute the speed PI controller and to add the duty 
+*        cycle feed forward of the load torque observer. The limits of the 
+*        PI controller are moved by the feed forward, so that the sum stays
+*        within the duty limits and the integrator does not wind up.
+*
+* @param Pointer to the data structure containing control parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_SpeedControllerUpdate(&pControl); </CODE>
+*
+*/
+static void MCAPP_SpeedControllerUpdate(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pControl)
+{
+    float feedForward = pControl->loadObserver.duty;
+    
+    pControl->piSpeed.param.outMax = pControl->speedLoop.outMax - feedForward;
+    pControl->piSpeed.param.outMin = pControl->speedLoop.outMin - feedForward;
+    pControl->piSpeed.inMeasure   = pControl->measuredSpeed;
+    MC_ControllerPIUpdate(&pControl->piSpeed);
+    pControl->pwmDuty = (uint32_t) ((float)((pControl->piSpeed.output + 
+                                    feedForward) * pControl->pwmPeriod)); 
+}
+
+/**
+* <B> Function: void MCAPP_SpeedLoopModeSet (MCAPP_CONTROL_SCHEME_T *, 
+*                                                   uint16_t, uint32_t)  </B>
+*
+* @brief Function to select the execution mode of the speed controller. The
+*        gains and limits of the PI controller and the control loop rate must
+*        be set, the integral gain is taken as the gain of the fixed rate 
+*        execution.
+*
+* @param Pointer to the data structure containing control parameters.
+* @param Execution mode, MCAPP_SPEED_LOOP_MODE_T.
+* @param Control loops without new speed measurement after which the 
+*        event triggered speed controller is executed.
+* @return none.
+* @example
+* <CODE> MCAPP_SpeedLoopModeSet(&pControl, SPEED_LOOP_EVENT, timeout); </CODE>
+*
+*/
+void MCAPP_SpeedLoopModeSet(MCAPP_CONTROL_SCHEME_T *pControl, uint16_t mode,
+                                                            uint32_t timeout)
+{
+    MCAPP_SPEED_LOOP_T *pLoop = &pControl->speedLoop;
+    
+    pLoop->mode = mode;
+    pLoop->timeout = timeout;
+    pLoop->elapsed = 0;
+    pLoop->kiPerLoop = pControl->piSpeed.param.ki / 
+                                    (float)(pControl->controlLoopRate + 2);
+    pLoop->outMax = pControl->piSpeed.param.outMax;
+    pLoop->outMin = pControl->piSpeed.param.outMin;
+}
+
+/**
+* <B> Function: void MCAPP_CommutationOutput (MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *)  </B>
+*
+* @brief Function to commutate the motor. Sinusoidal duties are applied 
+*        through the PWM generators in complementary mode with the override 
+*        disabled, otherwise the six-step override pattern of the commutation 
+*        sector is applied. The PWM generators operate in complementary mode 
+*        for sinusoidal commutation and for the complementary six-step 
+*        pattern, the output mode is changed only when this changes.
+*
+* @param Pointer to the data structure containing control parameters.
+* @return none.
+* @example
+* <CODE> MCAPP_CommutationOutput(&pControl); </CODE>
+*
+*/
+static void MCAPP_CommutationOutput(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pControl)
+{
+    MCAPP_SINE_MODULATION_T *pSine = &pControl->sine;
+    bool sineRequest, complementary;
+    
+    sineRequest = MCAPP_SineModulationSelect(pSine, pControl->measuredSpeed);
+    complementary = (sineRequest == 1) || 
+                    (pControl->pwmPattern == PWM_PATTERN_COMPLEMENTARY);
+    if(complementary != pControl->complementaryMode)
+    {
+        /* The PWM outputs stay overridden to 'LOW' till the output mode is
+           changed, the commutation is resumed in a following control loop */
+        pControl->appliedWord = PWM_COMMUTATION_WORD_NONE;
+        pControl->appliedDuty = PWM_DUTY_NONE;
+        if(HAL_PWMComplementaryModeSet(pControl->pHal, complementary) == 0)
+        {
+            return;
+        }
+        pControl->complementaryMode = complementary;
+    }
+    if(sineRequest != pSine->active)
+    {
+        pSine->active = sineRequest;
+        /* The six-step commutation word and duty are rewritten on return */
+        pControl->appliedWord = PWM_COMMUTATION_WORD_NONE;
+        pControl->appliedDuty = PWM_DUTY_NONE;
+        if(sineRequest == 1)
+        {
+            /* PWM Generators provide data for all the PWM outputs */
+            HAL_PWMOverrideEnableDataSet(pControl->pHal, 2, 
+                                                    DC_PLUS_COMPLEMENTARY);
+            HAL_PWMOverrideEnableDataSet(pControl->pHal, 1, 
+                                                    DC_PLUS_COMPLEMENTARY);
+            HAL_PWMOverrideEnableDataSet(pControl->pHal, 0, 
+                                                    DC_PLUS_COMPLEMENTARY);
+        }
+    }
+    
+    if(pSine->active == 1)
+    {
+        MCAPP_SineModulationUpdate(pSine, pControl->directionCmd, 
+                                    pControl->pwmDuty, pControl->pwmPeriod);
+    }
+    else
+    {
+        MCAPP_PWM_Override(pControl, pControl->commutationSector);
+    }
+}
+
  /**
-* <B> Function: void MCAPP_PWM_Override (uint16_t )  </B>
+* <B> Function: void MCAPP_PWM_Override (MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *, 
+*                                                               uint16_t)  </B>
 *
-* @brief Function to override PWM outputs.
+* @brief Function to override PWM outputs with the commutation word of the 
+*        sector. The PWM Generators are written only when the commutation 
+*        word changes.
 *
+* @param Pointer to the data structure containing control parameters.
 * @param Commutation sector.
 * @return none.
 * @example
-* <CODE> MCAPP_PWM_Override(sector); </CODE>
+* <CODE> MCAPP_PWM_Override(&pControl, sector); </CODE>
 *
 */
-static void MCAPP_PWM_Override(uint16_t sector)
+static void MCAPP_PWM_Override(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pControl, 
+                                                            uint16_t sector)
 {
-   PWM3_OverrideEnableDataSet(PWM3_STATE[sector]); 
-   PWM2_OverrideEnableDataSet(PWM2_STATE[sector]); 
-   PWM1_OverrideEnableDataSet(PWM1_STATE[sector]); 
+    uint16_t word = pControl->commutationWord[sector & 0x7];
+    
+    if(word != pControl->appliedWord)
+    {
+        HAL_PWMCommutationWordSet(pControl->pHal, word);
+        pControl->appliedWord = word;
+    }
 }
 
 /**
-* <B> Function: void MCAPP_LoadInverterSwitchingArray (uint16_t * , uint16_t *, uint16_t *)  </B>
+* <B> Function: void MCAPP_LoadInverterSwitchingArray (
+*       MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *, uint32_t *, uint32_t *, uint32_t *)  </B>
 *
 * @brief Function to load switching arrays for BLDC inverter control.
+*        The arrays hold either independent (DC_PLUS, DC_MINUS, PWM_OFF) or
+*        complementary (DC_PLUS_COMPLEMENTARY, DC_MINUS_COMPLEMENTARY, 
+*        PWM_OFF_COMPLEMENTARY) override data, selected by pwmPattern. The
+*        override data of the three phases is packed into one commutation 
+*        word for each of the sectors 0 to 6, sector 7 turns all phases OFF.
 *
-* @param switching arrays for PWM1,PWM2, and PWM3.
+* @param Pointer to the data structure containing control parameters.
+* @param switching arrays for phase C, B and A PWM Generators.
 * @return none.
 * @example
-* <CODE> MCAPP_LoadInverterSwitchingArray(sector); </CODE>
+* <CODE> MCAPP_LoadInverterSwitchingArray(&pControl, value3, value2, value1); </CODE>
 *
 */
-void MCAPP_LoadInverterSwitchingArray(uint32_t *value3, uint32_t *value2, uint32_t *value1)
+void MCAPP_LoadInverterSwitchingArray(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *pControl,
+                        uint32_t *value3, uint32_t *value2, uint32_t *value1)
 {
-    PWM3_STATE = value3;
-    PWM2_STATE = value2;
-    PWM1_STATE = value1;
+    uint16_t sector;
+    
+    for(sector = 0; sector < 7; sector++)
+    {
+        pControl->commutationWord[sector] = PWM_COMMUTATION_WORD(
+                        value1[sector], value2[sector], value3[sector]);
+    }
+    pControl->commutationWord[7] = 
+                        PWM_COMMUTATION_WORD(PWM_OFF, PWM_OFF, PWM_OFF);
+    pControl->appliedWord = PWM_COMMUTATION_WORD_NONE;
 }
\ No newline at end of file
@@ -58,7 +58,9 @@ extern "C" {
 
 void MCAPP_TrapezoidalControlInit(MCAPP_CONTROL_SCHEME_T *);
 void MCAPP_TrapezoidalControlStateMachine (MCAPP_CONTROL_SCHEME_T *);
-void MCAPP_LoadInverterSwitchingArray(uint32_t *,uint32_t *,uint32_t *);   
+void MCAPP_LoadInverterSwitchingArray(MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T *,
+                                        uint32_t *,uint32_t *,uint32_t *);   
+void MCAPP_SpeedLoopModeSet(MCAPP_CONTROL_SCHEME_T *, uint16_t, uint32_t);
 // </editor-fold>
 
 #ifdef	__cplusplus
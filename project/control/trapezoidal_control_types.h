@@ -63,6 +63,21 @@ typedef struct
         
 } MCAPP_CONTROL_T;
 
+typedef struct
+{
+    uint16_t
+        mode;               /* Execution mode, MCAPP_SPEED_LOOP_MODE_T */
+    uint32_t
+        elapsed,            /* Control loops since the last execution */
+        timeout;            /* Control loops without new speed measurement 
+                               after which the controller is executed */
+    float
+        kiPerLoop,          /* Integral gain per control loop elapsed */
+        outMax,             /* Duty limits of the speed controller and the */
+        outMin;             /* load torque feed forward together */
+        
+} MCAPP_SPEED_LOOP_T;
+
 // </editor-fold>
 
 #ifdef __cplusplus
@@ -49,7 +49,12 @@ extern "C" {
 #include <stdbool.h>
 #include "motor_types.h"
 #include "trapezoidal_control_types.h"
+#include "sine_modulation_types.h"
+#include "speed_trajectory_types.h"
+#include "position_control_types.h"
+#include "load_observer_types.h"
 #include "pi.h"
+#include "hal_binding_types.h"
 // </editor-fold>
 
 // <editor-fold defaultstate="expanded" desc="ENUMERATED CONSTANTS ">
@@ -62,6 +67,7 @@ typedef enum
     SPEED_CONTROL_LOOP = 3,             /* Closed loop Current control */
     CURRENT_CONTROL_LOOP = 4,           /* Closed loop Speed control */
     CONTROL_FAULT = 5,                  /* Control state machine is in Fault */ 
+    POSITION_CONTROL_LOOP = 6,          /* Closed loop Position control */
             
 }TRAPEZOIDAL_CONTROL_STATE_T;
 
@@ -70,33 +76,63 @@ typedef enum
     SPEED_CONTROL       = 1,       
     CURRENT_CONTROL     = 2,       
     OPEN_LOOP           = 3,       
+    POSITION_CONTROL    = 4,       
             
 }MCAPP_CRTL_LOOP_T;
+
+typedef enum
+{
+    PWM_PATTERN_INDEPENDENT     = 0,   /* Freewheeling through body diodes */
+    PWM_PATTERN_COMPLEMENTARY   = 1,   /* Synchronous rectification */
+            
+}MCAPP_PWM_PATTERN_T;
+
+typedef enum
+{
+    SPEED_LOOP_FIXED_RATE   = 0,   /* Executed every CRTL_LOOP_RATE + 2 loops */
+    SPEED_LOOP_EVENT        = 1,   /* Executed on new speed measurements */
+            
+}MCAPP_SPEED_LOOP_MODE_T;
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
 
 typedef struct
 {
+    /* Hot fields : read or written every control loop, kept together at the 
+       start of the structure. The inputs are written by the application 
+       before the control loop. */
+    float
+        measuredSpeed,      /* Variable for speed */
+        avgCurrent,         /* Variable for average current */
+        busVoltage;         /* DC bus voltage (unit : volts) */
+    uint32_t
+        pwmDuty,            /* Variable for PWM duty */
+        pwmPeriod,          /* Variable for PWM period */
+        appliedDuty;        /* Six-step duty written to the PWM Generators,
+                               PWM_DUTY_NONE = to be written */
+    const MCAPP_HAL_T
+        *pHal;              /* Peripherals driven by this instance */
     uint16_t
-        *pSector,           /* Pointer for Hall sector */
-        *pDirectionCmd,     /* Pointer for direction command */
+        appliedWord,        /* Commutation word applied to the PWM Generators,
+                               PWM_COMMUTATION_WORD_NONE = to be written */
         sector,             /* Variable for Hall sector value */
         commutationSector,  /* Variable for sector to commutate */ 
         directionCmd,       /* Variable for direction command */
-        faultStatus,        /* Variable for Fault Status */
         controlState,       /* State variable for control state machine */
         controlLoopRateCounter,   /* Index counter for PI control loop */
         controlLoopRate;          /* Variable for rate of execution of control loop */
-    uint32_t
-        pwmDuty,            /* Variable for PWM duty */
-        pwmPeriod;          /* Variable for PWM period */
-    float
-        *pMeasuredSpeed,    /* Pointer for Speed */
-        *pAvgCurrent,       /* Pointer for average current */
-        measuredSpeed,      /* Variable for speed */
-        avgCurrent;         /* Variable for average current */
+    bool
+        speedSample;        /* Speed measured from a new Hall or BEMF period */
     
+    /* Cold fields : configuration and fields changed on events */
+    uint16_t
+        commutationWord[8], /* Packed override data of the three phases for 
+                               each commutation sector, PWM_COMMUTATION_WORD */
+        faultStatus,        /* Variable for Fault Status */
+        pwmPattern;         /* Six-step PWM pattern, MCAPP_PWM_PATTERN_T */
+    bool
+        complementaryMode;  /* PWM Generators operate in complementary mode */
     
     MCAPP_MOTOR_T  motor;   /* Motor parameters */
     
@@ -106,9 +142,24 @@ typedef struct
     /* Parameters for PI Speed controllers */ 
     MC_PI_T     piSpeed;
     
+    MCAPP_SPEED_LOOP_T
+        speedLoop;          /* Execution of the speed controller */
+    
     MCAPP_CONTROL_T
         ctrlParam;          /* Parameters for control references */
     
+    MCAPP_SINE_MODULATION_T
+        sine;               /* Parameters for sinusoidal commutation */
+    
+    MCAPP_SPEED_TRAJECTORY_T
+        speedTrajectory;    /* Speed reference trajectory generator */
+    
+    MCAPP_POSITION_CONTROL_T
+        position;           /* Hall count position control */
+    
+    MCAPP_LOAD_OBSERVER_T
+        loadObserver;       /* Load torque observer and feed forward */
+    
 }MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T;
 
 // </editor-fold>
@@ -103,6 +103,20 @@ void InitializeADCs(void)
     AD3CH2CON1bits.FRAC = 0;
     AD3CH2CON1bits.DIFF = 0;
     
+#if IBUS_OVERSAMPLING > 0
+    /* Channel Configuration for IBUS oversampling*/
+    /*ADC3 Channel 3 for IBUS : OA3OUT/AD3AN0/CVDAN5/CMP3A/RP6/INT0/RA5 */ 
+    AD3CH3CON1bits.PINSEL = 0;      
+    AD3CH3CON1bits.SAMC = 3;      
+    AD3CH3CON1bits.FRAC = 0;
+    AD3CH3CON1bits.DIFF = 0;
+    /* Channel Mode bits
+       10 = Integration mode, results of CNT conversions are accumulated */
+    AD3CH3CON1bits.MODE = 2;
+    /* Number of conversions accumulated in the result*/
+    AD3CH3CNTbits.CNT = IBUS_OVERSAMPLING_FACTOR;
+#endif
+    
     /* Channel Configuration for VA*/
     /*ADC1 Channel 1 for VA : UREF/AD1AN3/CVDAN9/IBIAS2/ISRC2/RP10/RA9 */     
     AD1CH1CON1bits.PINSEL = 3;   
@@ -169,6 +183,12 @@ void InitializeADCs(void)
     AD3CH1CON1bits.TRG1SRC = 4;
     /*PWM1 ADC Trigger 1 for VBUS - AD3CH2*/
     AD3CH2CON1bits.TRG1SRC = 4;      
+#if IBUS_OVERSAMPLING > 0
+    /*PWM4 ADC Trigger 1 for the first and the subsequent conversions of the 
+      IBUS oversampling - AD3CH3*/
+    AD3CH3CON1bits.TRG1SRC = 10;
+    AD3CH3CON1bits.TRG2SRC = 10;
+#endif
   
 }
 
@@ -58,12 +58,23 @@
 /*Maximum count in 12-bit ADC*/
 #define MAX_ADC_COUNT     4096.0f
 #define HALF_ADC_COUNT    2048    
+/*Number of bus current samples accumulated per PWM period*/
+#define IBUS_OVERSAMPLING_FACTOR    (1 << IBUS_OVERSAMPLING)
         
 /*Converting 2^11 format to 2^15 format  */
-#define MC1_ADCBUF_IA    (int16_t)((AD1CH0DATA - HALF_ADC_COUNT)<<4)
-#define MC1_ADCBUF_IB    (int16_t)((AD2CH0DATA - HALF_ADC_COUNT)<<4)
-#define MC1_ADCBUF_IC    (int16_t)((AD3CH0DATA- HALF_ADC_COUNT)<<4) 
-#define ADCBUF_IBUS      (int16_t)((AD3CH1DATA- HALF_ADC_COUNT)<<4) 
+#define ADCBUF_CURRENT(buffer)  (int16_t)(((buffer) - HALF_ADC_COUNT)<<4)
+/*Sum of the bus current samples of one PWM period converted to 2^15 format, 
+  the accumulation adds IBUS_OVERSAMPLING bits of resolution */
+#define ADCBUF_CURRENT_AVG(buffer)  (int16_t)(((int32_t)(buffer) - \
+                (HALF_ADC_COUNT << IBUS_OVERSAMPLING)) << (4 - IBUS_OVERSAMPLING))
+
+#define MC1_ADCBUF_IA    ADCBUF_CURRENT(AD1CH0DATA)
+#define MC1_ADCBUF_IB    ADCBUF_CURRENT(AD2CH0DATA)
+#define MC1_ADCBUF_IC    ADCBUF_CURRENT(AD3CH0DATA) 
+#define ADCBUF_IBUS      ADCBUF_CURRENT(AD3CH1DATA) 
+#if IBUS_OVERSAMPLING > 0
+#define ADCBUF_IBUS_AVG  ADCBUF_CURRENT_AVG(AD3CH3DATA)
+#endif
         
 #define MC1_ADCBUF_POT   (int16_t)AD2CH1DATA
 #define MC_ADCBUF_VDC    (int16_t)AD3CH2DATA 
@@ -61,9 +61,30 @@ BUTTON_T buttonDirectionChange;
 
 uint16_t boardServiceISRCounter = 0;
 
+/* Peripherals of motor control instance 1 */
+const MCAPP_HAL_T halMC1 =
+{
+    .pwmGenerator = {1, 2, 3},
+    .pDutyCycle = {&PG1DC, &PG2DC, &PG3DC},
+    .pIoControl2 = {&PG1IOCON2, &PG2IOCON2, &PG3IOCON2},
+    .pIa = &AD1CH0DATA,
+    .pIb = &AD2CH0DATA,
+    .pIc = &AD3CH0DATA,
+    .pIbus = &AD3CH1DATA,
+#if IBUS_OVERSAMPLING > 0
+    .pIbusAvg = &AD3CH3DATA,
+#endif
+    .pPot = &AD2CH1DATA,
+    .pVdc = &AD3CH2DATA,
+    .pVa = &ADCBUF_INV_A_VA,
+    .pVb = &ADCBUF_INV_A_VB,
+    .pVc = &ADCBUF_INV_A_VC,
+};
+
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+static void HAL_PWMGeneratorOutputModeSet(uint16_t, uint16_t);
 
 static void ButtonGroupInitialize(void);
 static void ButtonScan(BUTTON_T * ,bool);
@@ -316,87 +337,67 @@ void HAL_ResetPeripherals(void)
 {
     MC1_ClearADCIF();
     MC1_EnableADCInterrupt();
-    HAL_MC1PWMDisableOutputs();
+    HAL_PWMDisableOutputs(&halMC1);
 }
 
 /**
-* <B> Function: HAL_MC1PWMEnableOutputs() </B>
+* <B> Function: HAL_PWMEnableOutputs(&pHal) </B>
 *
 * @brief Function to enable the PWM outputs -  override is removed
 * PWM generator controls the PWM outputs now
 *        
-* @param none.
+* @param Pointer to the peripherals of the motor control instance.
 * @return none.
 * 
 * @example
-* <CODE> HAL_MC1PWMEnableOutputs(); </CODE>
+* <CODE> HAL_PWMEnableOutputs(&pHal); </CODE>
 *
 */
-void HAL_MC1PWMEnableOutputs(void)
+void HAL_PWMEnableOutputs(const MCAPP_HAL_T *pHal)
 {
-    /* Set PWM Duty Cycles */
-    PWM_PDC3 = 0;
-    PWM_PDC2 = 0;
-    PWM_PDC1 = 0;
-	
-	/*  0 = PWM Generator provides data for the PWM3H pin */
-    PG3IOCON2bits.OVRENH = 0; 
-    /*  0 = PWM Generator provides data for the PWM3L pin */
-    PG3IOCON2bits.OVRENL = 0; 
-    
-    /*  0 = PWM Generator provides data for the PWM2H pin */
-    PG2IOCON2bits.OVRENH = 0;
-    /*  0 = PWM Generator provides data for the PWM2L pin */
-    PG2IOCON2bits.OVRENL = 0; 
+    uint16_t phase;
     
-    /*  0 = PWM Generator provides data for the PWM1H pin */
-    PG1IOCON2bits.OVRENH = 0;  
-    /*  0 = PWM Generator provides data for the PWM1L pin */
-    PG1IOCON2bits.OVRENL = 0;     
+    for(phase = 0; phase < 3; phase++)
+    {
+        /* Set PWM Duty Cycles */
+        *pHal->pDutyCycle[phase] = 0;
+    }
+    for(phase = 0; phase < 3; phase++)
+    {
+        /*  0 = PWM Generator provides data for the PWMxH and PWMxL pins */
+        HAL_PWMOverrideEnableDataSet(pHal, phase, PWM_OVERRIDE_RELEASE);
+    }
+    HAL_PWMUpdateRequest(pHal);
 }
 
 /**
-* <B> Function: HAL_MC1PWMDisableOutputs() </B>
+* <B> Function: HAL_PWMDisableOutputs(&pHal) </B>
 *
 * @brief Function to disable the PWM outputs -  override is activated
 * OVRDAT<> register controls the PWM outputs now
 *        
-* @param none.
+* @param Pointer to the peripherals of the motor control instance.
 * @return none.
 * 
 * @example
-* <CODE> HAL_MC1PWMDisableOutputs(); </CODE>
+* <CODE> HAL_PWMDisableOutputs(&pHal); </CODE>
 *
 */
-void HAL_MC1PWMDisableOutputs(void)
+void HAL_PWMDisableOutputs(const MCAPP_HAL_T *pHal)
 {
-    /* Set PWM Duty Cycles */
-    PWM_PDC3 = 0;
-    PWM_PDC2 = 0;
-    PWM_PDC1 = 0; 
-    
-    /** Set Override Data on all PWM outputs */
-    /* 0b00 = State for PWM3H,L, if Override is Enabled */
-    PG3IOCON2bits.OVRDAT = 0;
-    /* 0b00 = State for PWM2H,L, if Override is Enabled */
-    PG2IOCON2bits.OVRDAT = 0; 
-    /* 0b00 = State for PWM1H,L, if Override is Enabled */
-    PG1IOCON2bits.OVRDAT = 0;  
-
-    /* 1 = OVRDAT<1> provides data for output on PWM3H */
-    PG3IOCON2bits.OVRENH = 1; 
-    /* 1 = OVRDAT<0> provides data for output on PWM3L */
-    PG3IOCON2bits.OVRENL = 1; 
-    
-    /* 1 = OVRDAT<1> provides data for output on PWM2H */
-    PG2IOCON2bits.OVRENH = 1;
-    /* 1 = OVRDAT<0> provides data for output on PWM2L */
-    PG2IOCON2bits.OVRENL = 1; 
+    uint16_t phase;
     
-    /* 1 = OVRDAT<1> provides data for output on PWM1H */
-    PG1IOCON2bits.OVRENH = 1;  
-    /* 1 = OVRDAT<0> provides data for output on PWM1L */
-    PG1IOCON2bits.OVRENL = 1;     
+    for(phase = 0; phase < 3; phase++)
+    {
+        /* Set PWM Duty Cycles */
+        *pHal->pDutyCycle[phase] = 0;
+    }
+    for(phase = 0; phase < 3; phase++)
+    {
+        /* 1 = OVRDAT<1:0> = 0b00 provides data for PWMxH and PWMxL pins */
+        HAL_PWMOverrideEnableDataSet(pHal, phase, PWM_OFF);
+    }
+    HAL_PWMUpdateRequest(pHal);
 }
 
 /**
@@ -427,25 +428,147 @@ uint32_t HAL_MC1PWMDutyCycleLimitCheck(uint32_t dutycycle)
 }
 
 /**
-* <B> Function: HAL_PWM_DutyCycleRegister_Set(uint32_t) </B>
+* <B> Function: HAL_PWM_DutyCycleRegister_Set(&pHal, uint32_t) </B>
 *
-* @brief Function to set the duty cycle values to the PDC registers
+* @brief Function to set the duty cycle values to the PDC registers. The 
+*        duty cycle of phase A is written last, as its write updates the 
+*        PWM Generators of the instance.
 *        
+* @param Pointer to the peripherals of the motor control instance.
 * @param duty value
 * @return none.
 * 
 * @example
-* <CODE> HAL_PWM_DutyCycleRegister_Set(pwmDC); </CODE>
+* <CODE> HAL_PWM_DutyCycleRegister_Set(&pHal, pwmDC); </CODE>
 *
 */
-void HAL_PWM_DutyCycleRegister_Set(uint32_t pwmDC)
+void HAL_PWM_DutyCycleRegister_Set(const MCAPP_HAL_T *pHal, uint32_t pwmDC)
 {
     uint32_t pwmDuty;
     
     pwmDuty = HAL_MC1PWMDutyCycleLimitCheck(pwmDC);
-    PWM_PDC3 = (uint32_t)(pwmDuty);
-    PWM_PDC2 = (uint32_t)(pwmDuty);
-    PWM_PDC1 = (uint32_t)(pwmDuty);
+    *pHal->pDutyCycle[2] = pwmDuty;
+    *pHal->pDutyCycle[1] = pwmDuty;
+    *pHal->pDutyCycle[0] = pwmDuty;
+}
+
+/**
+* <B> Function: HAL_PWM_DutyCycleRegisters_Set(&pHal, uint32_t, uint32_t, 
+*                                                           uint32_t) </B>
+*
+* @brief Function to set individual duty cycle values to the PDC registers.
+*        The duty cycle of phase A is written last, as its write updates the 
+*        PWM Generators of the instance.
+*        
+* @param Pointer to the peripherals of the motor control instance.
+* @param duty value of phase A
+* @param duty value of phase B
+* @param duty value of phase C
+* @return none.
+* 
+* @example
+* <CODE> HAL_PWM_DutyCycleRegisters_Set(&pHal, pwmDC1, pwmDC2, pwmDC3); </CODE>
+*
+*/
+void HAL_PWM_DutyCycleRegisters_Set(const MCAPP_HAL_T *pHal, uint32_t pwmDC1, 
+                                        uint32_t pwmDC2, uint32_t pwmDC3)
+{
+    *pHal->pDutyCycle[2] = HAL_MC1PWMDutyCycleLimitCheck(pwmDC3);
+    *pHal->pDutyCycle[1] = HAL_MC1PWMDutyCycleLimitCheck(pwmDC2);
+    *pHal->pDutyCycle[0] = HAL_MC1PWMDutyCycleLimitCheck(pwmDC1);
+}
+
+/**
+* <B> Function: HAL_PWMComplementaryModeSet(&pHal, bool) </B>
+*
+* @brief Function to select the output mode of the PWM Generators. The output
+*        mode (PMOD) takes effect immediately while the override is applied 
+*        on the next update, so the output mode is changed only once all the
+*        PWM outputs are overridden to 'LOW' :
+*        (1) If the override is not written or its update is pending, the 
+*            override is requested and the output mode is not changed
+*        (2) Otherwise the output mode is changed
+*        The function is called again till it returns 1, the PWM outputs 
+*        remain overridden till the next commutation pattern is applied.
+*        
+* @param Pointer to the peripherals of the motor control instance.
+* @param 1 = Complementary mode, 0 = Independent mode.
+* @return 1 = output mode changed, 0 = override pending.
+* 
+* @example
+* <CODE> changed = HAL_PWMComplementaryModeSet(&pHal, 1); </CODE>
+*
+*/
+bool HAL_PWMComplementaryModeSet(const MCAPP_HAL_T *pHal, bool complementary)
+{
+    uint16_t phase;
+    bool overrideApplied = (HAL_PWMUpdatePending(pHal) == 0);
+    
+    for(phase = 0; phase < 3; phase++)
+    {
+        if((*pHal->pIoControl2[phase] & ~PWM_OVERRIDE_CLEAR_MASK) != PWM_OFF)
+        {
+            /* 1 = OVRDAT<1:0> = 0b00 provides data for PWMxH and PWMxL */
+            HAL_PWMOverrideEnableDataSet(pHal, phase, PWM_OFF);
+            overrideApplied = 0;
+        }
+    }
+    if(overrideApplied == 0)
+    {
+        HAL_PWMUpdateRequest(pHal);
+        return 0;
+    }
+    for(phase = 0; phase < 3; phase++)
+    {
+        /* 00 = PWM Generator outputs operate in Complementary mode, 
+           dead time is inserted between PWMxH and PWMxL
+           01 = PWM Generator outputs operate in Independent mode */
+        HAL_PWMGeneratorOutputModeSet(pHal->pwmGenerator[phase], 
+                                                    (complementary ? 0 : 1));
+    }
+    return 1;
+}
+
+/**
+* <B> Function: HAL_PWMGeneratorOutputModeSet(uint16_t, uint16_t) </B>
+*
+* @brief Function to set the output mode bits (PMOD) of a PWM Generator.
+*        
+* @param PWM Generator number (1 to 6).
+* @param Output mode : 0 = Complementary, 1 = Independent.
+* @return none.
+* 
+* @example
+* <CODE> HAL_PWMGeneratorOutputModeSet(1, 0); </CODE>
+*
+*/
+static void HAL_PWMGeneratorOutputModeSet(uint16_t generator, uint16_t mode)
+{
+    switch(generator)
+    {
+        case 1:
+            PG1IOCON1bits.PMOD = mode;
+            break;
+        case 2:
+            PG2IOCON1bits.PMOD = mode;
+            break;
+        case 3:
+            PG3IOCON1bits.PMOD = mode;
+            break;
+        case 4:
+            PG4IOCON1bits.PMOD = mode;
+            break;
+        case 5:
+            PG5IOCON1bits.PMOD = mode;
+            break;
+        case 6:
+            PG6IOCON1bits.PMOD = mode;
+            break;
+        default:
+            /* PWM Generator binding not supported */
+            HAL_TrapHandler();
+            break;
+    }
 }
 
 /**
@@ -462,7 +585,7 @@ void HAL_PWM_DutyCycleRegister_Set(uint32_t pwmDC)
 */
 void HAL_TrapHandler(void)
 {
-    HAL_MC1PWMDisableOutputs();
+    HAL_PWMDisableOutputs(&halMC1);
     while (1)
     {
         Nop();
@@ -471,86 +594,204 @@ void HAL_TrapHandler(void)
     }
 }
 
-/* Functions for PWMs ON and OFF  using override */
 /**
-* <B> Function: PWM1_OverrideEnableDataSet(uint32_t) </B>
+* <B> Function: HAL_PWMOverrideEnableDataSet(&pHal, uint16_t, uint32_t) </B>
 *
-* @brief Function to override PWM1.
+* @brief Function to override the PWM outputs of one phase. The override is
+*        applied on the next update of the PWM Generators, requested by a 
+*        write of the duty cycle of phase A or by HAL_PWMUpdateRequest.
 *        
+* @param Pointer to the peripherals of the motor control instance.
+* @param Phase : 0 = A, 1 = B, 2 = C.
 * @param override value.
 * @return none.
 * 
 * @example
-* <CODE> PWM1_OverrideEnableDataSet(data); </CODE>
+* <CODE> HAL_PWMOverrideEnableDataSet(&pHal, phase, data); </CODE>
 *
 */
-void PWM1_OverrideEnableDataSet(uint32_t data)
+void HAL_PWMOverrideEnableDataSet(const MCAPP_HAL_T *pHal, uint16_t phase, 
+                                                                uint32_t data)
 {
     uint32_t dataBuffer;
-    dataBuffer = PG1IOCON2 & 0xFFCFFFFF;
-    PG1IOCON2 = dataBuffer | data;
+    dataBuffer = *pHal->pIoControl2[phase] & PWM_OVERRIDE_CLEAR_MASK;
+    *pHal->pIoControl2[phase] = dataBuffer | data;
 }
+
 /**
-* <B> Function: PWM2_OverrideEnableDataSet(uint32_t) </B>
+* <B> Function: HAL_PWMCommutationWordSet(&pHal, uint16_t) </B>
 *
-* @brief Function to override PWM2.
+* @brief Function to override the PWM outputs of the three phases from a 
+*        packed commutation word (PWM_COMMUTATION_WORD) and to request the 
+*        update of the PWM Generators, so that the three phases switch at 
+*        the start of the same PWM cycle.
 *        
-* @param override value.
+* @param Pointer to the peripherals of the motor control instance.
+* @param Packed commutation word.
 * @return none.
 * 
 * @example
-* <CODE> PWM2_OverrideEnableDataSet(data); </CODE>
+* <CODE> HAL_PWMCommutationWordSet(&pHal, word); </CODE>
 *
 */
-void PWM2_OverrideEnableDataSet(uint32_t data)
+void HAL_PWMCommutationWordSet(const MCAPP_HAL_T *pHal, uint16_t word)
 {
     uint32_t dataBuffer;
-    dataBuffer = PG2IOCON2 & 0xFFCFFFFF;
-    PG2IOCON2 = dataBuffer | data;
+    uint16_t phase;
+    
+    for(phase = 0; phase < 3; phase++)
+    {
+        dataBuffer = *pHal->pIoControl2[phase] & PWM_OVERRIDE_CLEAR_MASK;
+        *pHal->pIoControl2[phase] = dataBuffer | 
+            ((uint32_t)((word >> (PWM_COMMUTATION_PHASE_BITS * phase)) & 
+                                PWM_OVERRIDE_FIELD) << PWM_OVERRIDE_SHIFT);
+    }
+    HAL_PWMUpdateRequest(pHal);
 }
+
 /**
-* <B> Function: PWM3_OverrideEnableDataSet(uint32_t) </B>
+* <B> Function: HAL_PWMUpdateRequest(&pHal) </B>
 *
-* @brief Function to override PWM3.
+* @brief Function to request the update of the PWM Generators of the 
+*        instance. The master PWM Generator (phase A) broadcasts the update 
+*        request, the buffered registers and the overrides of the three 
+*        phases are updated at the start of the next PWM cycle. A PWM 
+*        Generator other than 1 to 6 is a binding error, it traps.
 *        
-* @param override value.
+* @param Pointer to the peripherals of the motor control instance.
 * @return none.
 * 
 * @example
-* <CODE> PWM3_OverrideEnableDataSet(data); </CODE>
+* <CODE> HAL_PWMUpdateRequest(&pHal); </CODE>
 *
 */
-void PWM3_OverrideEnableDataSet(uint32_t data)
+void HAL_PWMUpdateRequest(const MCAPP_HAL_T *pHal)
 {
-    uint32_t dataBuffer;
-    dataBuffer = PG3IOCON2 & 0xFFCFFFFF;
-    PG3IOCON2 = dataBuffer | data;
+    switch(pHal->pwmGenerator[0])
+    {
+        case 1:
+            PG1STATbits.UPDREQ = 1;
+            break;
+        case 2:
+            PG2STATbits.UPDREQ = 1;
+            break;
+        case 3:
+            PG3STATbits.UPDREQ = 1;
+            break;
+        case 4:
+            PG4STATbits.UPDREQ = 1;
+            break;
+        case 5:
+            PG5STATbits.UPDREQ = 1;
+            break;
+        case 6:
+            PG6STATbits.UPDREQ = 1;
+            break;
+        default:
+            /* PWM Generator binding not supported */
+            HAL_TrapHandler();
+            break;
+    }
 }
 /**
-* <B> Function: HAL_MC1MotorInputsRead(MCAPP_MEASURE_T *)  </B>
+* <B> Function: HAL_PWMUpdatePending(&pHal) </B>
+*
+* @brief Function to read if the requested update of the PWM Generators of 
+*        the instance is pending, the master PWM Generator (phase A) 
+*        broadcasts the update.
+*        
+* @param Pointer to the peripherals of the motor control instance.
+* @return 1 = update pending, 0 = update completed.
+* 
+* @example
+* <CODE> pending = HAL_PWMUpdatePending(&pHal); </CODE>
+*
+*/
+bool HAL_PWMUpdatePending(const MCAPP_HAL_T *pHal)
+{
+    switch(pHal->pwmGenerator[0])
+    {
+        case 1:
+            return PG1STATbits.UPDATE;
+        case 2:
+            return PG2STATbits.UPDATE;
+        case 3:
+            return PG3STATbits.UPDATE;
+        case 4:
+            return PG4STATbits.UPDATE;
+        case 5:
+            return PG5STATbits.UPDATE;
+        case 6:
+            return PG6STATbits.UPDATE;
+        default:
+            /* PWM Generator binding not supported */
+            HAL_TrapHandler();
+            return 1;
+    }
+}
+
+/**
+* <B> Function: HAL_PWMUpdateWait(&pHal) </B>
+*
+* @brief Function to wait for the requested update of the PWM Generators of 
+*        the instance, at most PWM_UPDATE_WAIT_COUNTS polls. To be used only 
+*        outside the interrupts while the PWM outputs are disabled, not in 
+*        the control loop.
+*        
+* @param Pointer to the peripherals of the motor control instance.
+* @return 1 = update completed, 0 = update still pending.
+* 
+* @example
+* <CODE> HAL_PWMUpdateWait(&pHal); </CODE>
+*
+*/
+bool HAL_PWMUpdateWait(const MCAPP_HAL_T *pHal)
+{
+    uint32_t wait = PWM_UPDATE_WAIT_COUNTS;
+    
+    while(HAL_PWMUpdatePending(pHal) == 1)
+    {
+        if(wait == 0)
+        {
+            return 0;
+        }
+        wait--;
+    }
+    return 1;
+}
+
+/**
+* <B> Function: HAL_MotorInputsRead(&pHal, MCAPP_MEASURE_T *)  </B>
 *
 * @brief Function to assign the variables with respective ADC buffers
 *        
+* @param Pointer to the peripherals of the motor control instance.
 * @param Pointer to the data structure containing measured currents.
 * @return none.
 * 
 * @example
-* <CODE> HAL_MC1MotorInputsRead(pMotorInputs); </CODE>
+* <CODE> HAL_MotorInputsRead(&pHal, pMotorInputs); </CODE>
 *
 */
-void HAL_MC1MotorInputsRead(MCAPP_MEASURE_T *pMotorInputs)
+void HAL_MotorInputsRead(const MCAPP_HAL_T *pHal, MCAPP_MEASURE_T *pMotorInputs)
 {
-    pMotorInputs->measureCurrent.Ia = MC1_ADCBUF_IA;
-    pMotorInputs->measureCurrent.Ib = MC1_ADCBUF_IB;
-    pMotorInputs->measureCurrent.Ic = MC1_ADCBUF_IC;
-    pMotorInputs->measureCurrent.Ibus = ADCBUF_IBUS;
-    pMotorInputs->measurePot = MC1_ADCBUF_POT;
-    pMotorInputs->measureVdc.count = MC_ADCBUF_VDC;
-    pMotorInputs->measureVdc.value = 
+    pMotorInputs->measureCurrent.Ia = ADCBUF_CURRENT(*pHal->pIa);
+    pMotorInputs->measureCurrent.Ib = ADCBUF_CURRENT(*pHal->pIb);
+    pMotorInputs->measureCurrent.Ic = ADCBUF_CURRENT(*pHal->pIc);
+    pMotorInputs->measureCurrent.Ibus = ADCBUF_CURRENT(*pHal->pIbus);
+#if IBUS_OVERSAMPLING > 0
+    pMotorInputs->measureCurrent.IbusAvg = ADCBUF_CURRENT_AVG(*pHal->pIbusAvg);
+#endif
+    pMotorInputs->measurePot = (int16_t)(*pHal->pPot);
+    pMotorInputs->measureVdc.count = (int16_t)(*pHal->pVdc);
+    if(pMotorInputs->signals & MEASURE_SIGNAL_BUS_VOLTAGE)
+    {
+        pMotorInputs->measureVdc.value = 
                 (float)(pMotorInputs->measureVdc.count * ADC_VOLTAGE_SCALE);
-    pMotorInputs->measurePhaseVolt.Va = ADCBUF_INV_A_VA;
-    pMotorInputs->measurePhaseVolt.Vb = ADCBUF_INV_A_VB;
-    pMotorInputs->measurePhaseVolt.Vc = ADCBUF_INV_A_VC;
+    }
+    pMotorInputs->measurePhaseVolt.Va = *pHal->pVa;
+    pMotorInputs->measurePhaseVolt.Vb = *pHal->pVb;
+    pMotorInputs->measurePhaseVolt.Vc = *pHal->pVc;
 }
 
 /**
@@ -574,20 +815,113 @@ void HAL_MC1ClearPWMPCIFault(void)
 }
 
 /**
-* <B> Function: SetADCSamplingPoint(uint16_t) </B>
+* <B> Function: HAL_MC1CurrentLimitActive(void)  </B>
 *
-* @brief Function to set the ADC sampling point.
+* @brief Function to read the status of the cycle-by-cycle current limit 
+*        PCI of motor 1.
 *        
 * @param none.
+* @return 1 = PWM outputs are truncated by the current limit.
+* 
+* @example
+* <CODE> HAL_MC1CurrentLimitActive(); </CODE>
+*
+*/
+bool HAL_MC1CurrentLimitActive(void)
+{
+    return PCI_CURRENT_LIMIT_ACTIVE_STATUS;
+}
+
+/**
+* <B> Function: HAL_MC1CurrentLimitReferenceSet(uint16_t)  </B>
+*
+* @brief Function to set the threshold of the cycle-by-cycle current limit
+*        of motor 1 (comparator 3 DAC reference).
+*        
+* @param DAC reference value.
+* @return none.
+* 
+* @example
+* <CODE> HAL_MC1CurrentLimitReferenceSet(reference); </CODE>
+*
+*/
+void HAL_MC1CurrentLimitReferenceSet(uint16_t reference)
+{
+    CMP3_ReferenceSet(reference);
+}
+
+/**
+* <B> Function: SetADCSamplingPoint(uint16_t) </B>
+*
+* @brief Function to set the ADC sampling point to the fixed position in 
+*        the first or the second half of the PWM cycle.
+*        
+* @param PWM cycle half (0 = first half, 1 = second half).
 * @return none.
 * 
 * @example
-* <CODE> SetADCSamplingPoint(); </CODE>
+* <CODE> SetADCSamplingPoint(1); </CODE>
 *
 */
 void SetADCSamplingPoint(uint16_t value)
 {
     PG1TRIGAbits.CAHALF = value;
+    PG1TRIGAbits.TRIGA  = ADC_SAMPLING_POINT;
+}
+
+/**
+* <B> Function: HAL_ADCSamplingPointUpdate(uint32_t, uint32_t) </B>
+*
+* @brief Function to place the ADC sampling point in the middle of the bus 
+*        current pulse of the next PWM cycle. In center aligned mode the 
+*        PWM on times are centred at the start of the second half of the 
+*        PWM cycle. The bus current flows while the phase with the highest 
+*        duty is on and the phase with the middle duty is off, hence :
+*        (1) Middle duty 0 (six-step) : one pulse centred on the PWM cycle
+*        (2) Middle duty > 0 : pulse before the centre between the edges of
+*            the highest and the middle duty
+*        The TRIGA update is applied with the next duty cycle update.
+*        
+* @param Highest duty of the three phases.
+* @param Middle duty of the three phases.
+* @return Pulse long enough for the bus current to settle before sampling.
+* 
+* @example
+* <CODE> valid = HAL_ADCSamplingPointUpdate(dutyHigh, dutyMiddle); </CODE>
+*
+*/
+bool HAL_ADCSamplingPointUpdate(uint32_t dutyHigh, uint32_t dutyMiddle)
+{
+    uint32_t pulseWidth;
+    int32_t samplePoint;
+    
+    dutyHigh = HAL_MC1PWMDutyCycleLimitCheck(dutyHigh);
+    if(dutyMiddle == 0)
+    {
+        pulseWidth = dutyHigh << 1;
+        samplePoint = 0;
+    }
+    else
+    {
+        pulseWidth = dutyHigh - dutyMiddle;
+        samplePoint = -(int32_t)((dutyHigh + dutyMiddle) >> 1);
+    }
+    
+    /* Centre the ADC sampling window on the sample point, relative to the 
+       centre of the PWM cycle */
+    samplePoint = samplePoint - (int32_t)(ADC_SAMPLE_WINDOW_COUNTS >> 1);
+    if(samplePoint < 0)
+    {
+        PG1TRIGAbits.CAHALF = 0;
+        PG1TRIGAbits.TRIGA  = (uint32_t)((int32_t)LOOPTIME_TCY + samplePoint);
+    }
+    else
+    {
+        PG1TRIGAbits.CAHALF = 1;
+        PG1TRIGAbits.TRIGA  = (uint32_t)samplePoint;
+    }
+    
+    return (pulseWidth >= ADC_MIN_PULSE_COUNTS);
 }
 
 // </editor-fold>
\ No newline at end of file
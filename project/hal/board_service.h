@@ -54,6 +54,7 @@
 #include "port_config.h"
 #include "timer1.h"
 #include "measure.h"
+#include "hal_binding_types.h"
 
 // </editor-fold>
 
@@ -111,6 +112,37 @@ typedef struct
 #define DC_PLUS  0x00100000  // Macro for DC+ state
 #define DC_MINUS 0x00200000  // Macro for DC- state
 #define PWM_OFF  0x00300000  // Macro for OFF state
+
+/* PWM override macros for complementary inverter switching (synchronous 
+   rectification), the PWM Generators operate in complementary mode */
+#define DC_PLUS_COMPLEMENTARY   0x00000000  // PWMxH switching, PWMxL complementary
+#define DC_MINUS_COMPLEMENTARY  0x00340000  // PWMxH OFF, PWMxL ON
+#define PWM_OFF_COMPLEMENTARY   PWM_OFF     // PWMxH OFF, PWMxL OFF
+
+/* Mask to clear OVRENH, OVRENL and OVRDAT<1:0> of PGxIOCON2 */
+#define PWM_OVERRIDE_CLEAR_MASK 0xFFC3FFFF
+/* PWM Generator provides data for PWMxH and PWMxL */
+#define PWM_OVERRIDE_RELEASE    0x00000000
+
+/* Packed commutation word : OVRENH, OVRENL and OVRDAT<1:0> (PGxIOCON2<21:18>)
+   of phase A, B and C in bits <3:0>, <7:4> and <11:8> */
+#define PWM_OVERRIDE_SHIFT      18
+#define PWM_OVERRIDE_FIELD      0xF
+#define PWM_COMMUTATION_PHASE_BITS  4
+#define PWM_COMMUTATION_WORD(dataA, dataB, dataC)                             \
+        (uint16_t)((((dataA) >> PWM_OVERRIDE_SHIFT) & PWM_OVERRIDE_FIELD) |   \
+        ((((dataB) >> PWM_OVERRIDE_SHIFT) & PWM_OVERRIDE_FIELD) << 4) |       \
+        ((((dataC) >> PWM_OVERRIDE_SHIFT) & PWM_OVERRIDE_FIELD) << 8))
+/* Commutation word not applied to the PWM Generators, never packed */
+#define PWM_COMMUTATION_WORD_NONE   0xFFFF
+/* Duty cycle not applied to the PWM Generators */
+#define PWM_DUTY_NONE               0xFFFFFFFF
+/* Polls of a pending PWM Generator update, at least two PWM periods */
+#define PWM_UPDATE_WAIT_COUNTS      (uint32_t)(2*FCY/PWMFREQUENCY_HZ)
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="VARIABLES ">
+extern const MCAPP_HAL_T halMC1;
 // </editor-fold>
 
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
@@ -123,18 +155,26 @@ bool IsPressed_Button2(void);
 void HAL_InitPeripherals(void);
 void HAL_ResetPeripherals(void);
 
-void HAL_MC1PWMDisableOutputs(void);
-void HAL_MC1PWMEnableOutputs(void);
+void HAL_PWMDisableOutputs(const MCAPP_HAL_T *);
+void HAL_PWMEnableOutputs(const MCAPP_HAL_T *);
 uint32_t HAL_MC1PWMDutyCycleLimitCheck(uint32_t);
-void HAL_PWM_DutyCycleRegister_Set(uint32_t);
-void HAL_MC1MotorInputsRead(MCAPP_MEASURE_T *);
+void HAL_PWM_DutyCycleRegister_Set(const MCAPP_HAL_T *, uint32_t);
+void HAL_PWM_DutyCycleRegisters_Set(const MCAPP_HAL_T *, uint32_t, uint32_t, 
+                                                                    uint32_t);
+bool HAL_PWMComplementaryModeSet(const MCAPP_HAL_T *, bool);
+void HAL_MotorInputsRead(const MCAPP_HAL_T *, MCAPP_MEASURE_T *);
 
 void HAL_MC1ClearPWMPCIFault(void);
+bool HAL_MC1CurrentLimitActive(void);
+void HAL_MC1CurrentLimitReferenceSet(uint16_t);
 void HAL_TrapHandler(void);
-void PWM1_OverrideEnableDataSet(uint32_t );
-void PWM2_OverrideEnableDataSet(uint32_t );
-void PWM3_OverrideEnableDataSet(uint32_t );
+void HAL_PWMOverrideEnableDataSet(const MCAPP_HAL_T *, uint16_t, uint32_t);
+void HAL_PWMCommutationWordSet(const MCAPP_HAL_T *, uint16_t);
+void HAL_PWMUpdateRequest(const MCAPP_HAL_T *);
+bool HAL_PWMUpdatePending(const MCAPP_HAL_T *);
+bool HAL_PWMUpdateWait(const MCAPP_HAL_T *);
 void SetADCSamplingPoint(uint16_t );
+bool HAL_ADCSamplingPointUpdate(uint32_t, uint32_t);
 // </editor-fold
 
 #ifdef __cplusplus
@@ -0,0 +1,83 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file hal_binding_types.h
+ *
+ * @brief This header file lists the data type binding a motor control
+ * instance to its peripherals.
+ *
+ * Component: HAL
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef HAL_BINDING_TYPES_H
+#define	HAL_BINDING_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+/**
+ * Peripherals of one motor control instance. Index 0, 1 and 2 of the PWM
+ * arrays are the PWM Generators driving phase A, B and C, the generator of
+ * phase A is the master which updates the others on a write of its duty cycle.
+*/
+typedef struct
+{
+    uint16_t
+        pwmGenerator[3];    /* PWM Generator number of each phase */
+    volatile uint32_t
+        *pDutyCycle[3],     /* PGxDC : Duty cycle register */
+        *pIoControl2[3],    /* PGxIOCON2 : Override control register */
+        *pIa,               /* ADC data register of A phase current */
+        *pIb,               /* ADC data register of B phase current */
+        *pIc,               /* ADC data register of C phase current */
+        *pIbus,             /* ADC data register of bus current */
+        *pIbusAvg,          /* ADC data register of oversampled bus current */
+        *pPot,              /* ADC data register of potentiometer */
+        *pVdc,              /* ADC data register of DC bus voltage */
+        *pVa,               /* ADC data register of A phase voltage */
+        *pVb,               /* ADC data register of B phase voltage */
+        *pVc;               /* ADC data register of C phase voltage */
+}MCAPP_HAL_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* HAL_BINDING_TYPES_H */
+
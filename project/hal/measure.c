@@ -42,6 +42,7 @@
 #include <stdbool.h>
 
 #include "measure.h"
+#include "board_service.h"
 #include "filter.h"
 #include "mc1_calc_params.h"
 // </editor-fold>
@@ -61,8 +62,10 @@
 void MCAPP_MeasureInit(MCAPP_MEASURE_T *pMotorInputs)
 {
     MCAPP_MeasureCurrentInit(pMotorInputs);
-    MCAPP_MovingAvgFilterInit();
+    MCAPP_LowPassFilterInit(&pMotorInputs->busCurrentFilter, 
+        FILTER_LPF_COEFF(BUS_CURRENT_FILTER_CUTOFF_HZ, PWMFREQUENCY_HZ));
     MCAPP_HallSensorInit(&pMotorInputs->detectRotorPosition);
+    MCAPP_BemfZeroCrossInit(&pMotorInputs->detectBemf);
 }
 
 /**
@@ -90,6 +93,7 @@ void MCAPP_MeasureCurrentInit(MCAPP_MEASURE_T *pMotorInputs)
     pCurrent->sumIc = 0;
     pCurrent->sumIbus = 0;
     pCurrent->status = 0;
+    pCurrent->IbusValid = 1;
 }
 
 /**
@@ -156,14 +160,33 @@ void MCAPP_MeasureCurrentCalibrate(MCAPP_MEASURE_T *pMotorInputs)
     pCurrent->Ib = pCurrent->Ib  - pCurrent->offsetIb;
     pCurrent->Ic = pCurrent->Ic  - pCurrent->offsetIc;
     pCurrent->Ibus = pCurrent->Ibus - pCurrent->offsetIbus;
+#if IBUS_OVERSAMPLING > 0
+    pCurrent->IbusAvg = pCurrent->IbusAvg - pCurrent->offsetIbus;
+    if(pMotorInputs->signals & MEASURE_SIGNAL_BUS_CURRENT_AVG)
+    {
+        pCurrent->IbusAvg_actual = 
+                            (float)(pCurrent->IbusAvg * ADC_CURRENT_SCALE);
+    }
+#endif
     
     /*Convert ADC Counts to real value*/
-    pCurrent->Ia_actual = (float)(pCurrent->Ia * ADC_CURRENT_SCALE);
-    pCurrent->Ib_actual = (float)(pCurrent->Ib * ADC_CURRENT_SCALE);
-    pCurrent->Ic_actual = (float)(pCurrent->Ic * ADC_CURRENT_SCALE);
+    if(pMotorInputs->signals & MEASURE_SIGNAL_PHASE_CURRENT)
+    {
+        pCurrent->Ia_actual = (float)(pCurrent->Ia * ADC_CURRENT_SCALE);
+        pCurrent->Ib_actual = (float)(pCurrent->Ib * ADC_CURRENT_SCALE);
+        pCurrent->Ic_actual = (float)(pCurrent->Ic * ADC_CURRENT_SCALE);
+    }
     
-    pCurrent->Ibus_actual = (float)(pCurrent->Ibus * ADC_CURRENT_SCALE);
-	pMotorInputs->filterBusCurrent = MCAPP_LowPassFilter(pCurrent->Ibus_actual);
+    /* Bus current pulse too short to be sampled : the last valid bus current
+       is held */
+    if((pCurrent->IbusValid) && 
+            (pMotorInputs->signals & MEASURE_SIGNAL_BUS_CURRENT))
+    {
+        pCurrent->Ibus_actual = (float)(pCurrent->Ibus * ADC_CURRENT_SCALE);
+        pMotorInputs->filterBusCurrent = 
+                                MCAPP_LowPassFilter(&pMotorInputs->busCurrentFilter,
+                                                    pCurrent->Ibus_actual);
+    }
     
 }
 /**
@@ -200,10 +223,160 @@ void MCAPP_MeasureActualPhaseVoltage(MCAPP_MEASURE_T *pMotorInputs)
     
     pVoltage = &pMotorInputs->measurePhaseVolt;
     
+    if((pMotorInputs->signals & MEASURE_SIGNAL_PHASE_VOLTAGE) == 0)
+    {
+        return;
+    }
     pVoltage->Va_actual = (float)(pVoltage->Va * ADC_VOLTAGE_SCALE);
     pVoltage->Vb_actual = (float)(pVoltage->Vb * ADC_VOLTAGE_SCALE);
     pVoltage->Vc_actual = (float)(pVoltage->Vc * ADC_VOLTAGE_SCALE);
 }
+/**
+* <B> Function: MCAPP_MeasureSubscribe(&pMotorInputs, consumer, signals)  </B>
+*
+* @brief Function to set the measured signals a consumer needs in actual 
+*        values, it replaces the previous subscription of the consumer. 
+*        Signals without any subscriber are not converted.
+*
+* @param Pointer to the data structure containing measured quantities.
+* @param Consumer of the measured signals.
+* @param Signals needed by the consumer (MEASURE_SIGNAL_xxx), 0 = none.
+* @return none.
+* @example
+* <CODE> MCAPP_MeasureSubscribe(&pMotorInputs, consumer, signals); </CODE>
+*
+*/
+void MCAPP_MeasureSubscribe(MCAPP_MEASURE_T *pMotorInputs, 
+                        MCAPP_MEASURE_CONSUMER_T consumer, uint16_t signals)
+{
+    uint16_t index, subscribed = 0;
+    
+    if(pMotorInputs->subscription[consumer] == signals)
+    {
+        return;
+    }
+    pMotorInputs->subscription[consumer] = signals;
+    
+    for(index = 0; index < MEASURE_CONSUMER_COUNT; index++)
+    {
+        subscribed |= pMotorInputs->subscription[index];
+    }
+    pMotorInputs->signals = subscribed;
+}
+
+/**
+* <B> Function: MCAPP_MeasureConductingPhaseLoad(&pMotorInputs, pPwm3State, 
+*                                           pPwm2State, pPwm1State)  </B>
+*
+* @brief Function to find the phase connected to DC- in each commutation 
+*        sector from the inverter switching arrays obtained from the Hall 
+*        sequence identifier (independent PWM pattern).
+*
+* @param Pointer to the data structure containing measured quantities.
+* @param Switching arrays for PWM3, PWM2 and PWM1.
+* @return none.
+* @example
+* <CODE> MCAPP_MeasureConductingPhaseLoad(&pMotorInputs, pwm3, pwm2, pwm1);
+* </CODE>
+*
+*/
+void MCAPP_MeasureConductingPhaseLoad(MCAPP_MEASURE_T *pMotorInputs, 
+                const uint32_t *pPwm3State, const uint32_t *pPwm2State, 
+                const uint32_t *pPwm1State)
+{
+    MCAPP_MEASURE_CONDUCTING_T *pConducting = &pMotorInputs->conductingCurrent;
+    uint16_t sector;
+    
+    for(sector = 0; sector < 8; sector++)
+    {
+        pConducting->lowSidePhase[sector] = CONDUCTING_PHASE_NONE;
+    }
+    for(sector = 1; sector < 7; sector++)
+    {
+        if(pPwm1State[sector] == DC_MINUS)
+        {
+            pConducting->lowSidePhase[sector] = 0;
+        }
+        else if(pPwm2State[sector] == DC_MINUS)
+        {
+            pConducting->lowSidePhase[sector] = 1;
+        }
+        else if(pPwm3State[sector] == DC_MINUS)
+        {
+            pConducting->lowSidePhase[sector] = 2;
+        }
+    }
+    pConducting->enable = 1;
+}
+
+/**
+* <B> Function: MCAPP_MeasureConductingCurrent(&pMotorInputs, sector, 
+*                                                       busCurrentOnly)  </B>
+*
+* @brief Function to measure the current of the conducting phases from the 
+*        phase shunt of the phase connected to DC-. Its low side switch 
+*        conducts during the PWM on and off time, the current sampled in the
+*        middle of the pulse is the average current. The bus current is used 
+*        before the table is loaded, on phase current saturation and if 
+*        requested (no single phase connected to DC-).
+*        Executed after MCAPP_MeasureCurrentCalibrate.
+*
+* @param Pointer to the data structure containing measured quantities.
+* @param Commutation sector applied while the currents were sampled.
+* @param 1 = use the bus current.
+* @return none.
+* @example
+* <CODE> MCAPP_MeasureConductingCurrent(&pMotorInputs, sector, 0); </CODE>
+*
+*/
+void MCAPP_MeasureConductingCurrent(MCAPP_MEASURE_T *pMotorInputs, 
+                                        uint16_t sector, bool busCurrentOnly)
+{
+    MCAPP_MEASURE_CONDUCTING_T *pConducting = &pMotorInputs->conductingCurrent;
+    MCAPP_MEASURE_CURRENT_T *pCurrent = &pMotorInputs->measureCurrent;
+    int16_t current, offset;
+    uint16_t phase = CONDUCTING_PHASE_NONE;
+    
+    if((pConducting->enable == 1) && (busCurrentOnly == 0))
+    {
+        phase = pConducting->lowSidePhase[sector & 0x7];
+    }
+    switch(phase)
+    {
+        case 0:
+            current = pCurrent->Ia;
+            offset = pCurrent->offsetIa;
+            break;
+        case 1:
+            current = pCurrent->Ib;
+            offset = pCurrent->offsetIb;
+            break;
+        case 2:
+            current = pCurrent->Ic;
+            offset = pCurrent->offsetIc;
+            break;
+        default:
+            pConducting->current = pCurrent->Ibus_actual;
+            pConducting->saturated = 0;
+            return;
+    }
+    
+    /* Saturation is checked on the amplifier output before offset correction */
+    pConducting->saturated = 
+        ((((int32_t)current + offset) >= PHASE_CURRENT_SATURATION) ||
+        (((int32_t)current + offset) <= -PHASE_CURRENT_SATURATION));
+    if(pConducting->saturated)
+    {
+        pConducting->current = pCurrent->Ibus_actual;
+    }
+    else
+    {
+        /* Phase current is positive into the motor, the conducting phases 
+           current returns through the phase connected to DC- */
+        pConducting->current = -(float)(current * ADC_CURRENT_SCALE);
+    }
+}
+
 /**
 * <B> Function: MCAPP_MeasureAvgInit(MCAPP_MEASURE_AVG_T *, uint16_t )          </B>
 *
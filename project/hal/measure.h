@@ -46,7 +46,10 @@ extern "C" {
 // <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "hall_sensor.h"
+#include "bemf_zero_cross.h"
+#include "filter_types.h"
 #include "mc1_user_params.h"
 // </editor-fold>
 
@@ -55,6 +58,39 @@ extern "C" {
 #define OFFSET_COUNT_BITS   (int16_t)10
 #define OFFSET_COUNT_MAX    (int16_t)(1 << OFFSET_COUNT_BITS)
 
+/* Cut-off frequency of the bus current low pass filter (unit : Hz) */
+#define BUS_CURRENT_FILTER_CUTOFF_HZ    350.0f
+
+/* Measured signals converted to actual values, a signal is converted only 
+   if at least one consumer has subscribed to it */
+#define MEASURE_SIGNAL_PHASE_CURRENT    0x0001  /* Ia/Ib/Ic_actual */
+#define MEASURE_SIGNAL_BUS_CURRENT      0x0002  /* Ibus_actual,filterBusCurrent*/
+#define MEASURE_SIGNAL_BUS_CURRENT_AVG  0x0004  /* IbusAvg_actual */
+#define MEASURE_SIGNAL_PHASE_VOLTAGE    0x0008  /* Va/Vb/Vc_actual */
+#define MEASURE_SIGNAL_BUS_VOLTAGE      0x0010  /* measureVdc.value */
+#define MEASURE_SIGNAL_ALL              0x001F
+
+/* Phase current (2^15 format, before offset correction) beyond which the 
+   phase current amplifier is considered saturated */
+#define PHASE_CURRENT_SATURATION        32000
+/* Phase index when no phase is connected to DC- */
+#define CONDUCTING_PHASE_NONE           3
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="ENUMERATED CONSTANTS ">
+
+typedef enum
+{
+    MEASURE_CONSUMER_CONTROL = 0,       /* Control and Hall identifier */
+    MEASURE_CONSUMER_PROTECTION = 1,    /* Fault and limit monitoring */
+    MEASURE_CONSUMER_DIAGNOSTICS = 2,   /* X2C Scope */
+    MEASURE_CONSUMER_METERING = 3,      /* Power and energy meter */
+    MEASURE_CONSUMER_OBSERVER = 4,      /* Load torque feed forward */
+    MEASURE_CONSUMER_COUNT = 5,
+
+}MCAPP_MEASURE_CONSUMER_T;
+
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
@@ -65,7 +101,8 @@ typedef struct
         Ia_actual,
         Ib_actual,
         Ic_actual,
-        Ibus_actual;
+        Ibus_actual,
+        IbusAvg_actual;
     
     int16_t
         offsetIa,       /* A phase current offset */
@@ -76,6 +113,8 @@ typedef struct
         Ib,             /* B phase Current Feedback */
         Ic,             /* C phase Current Feedback */
         Ibus,           /* Bus current Feedback */
+        IbusValid,      /* flag to indicate bus current sample is valid */
+        IbusAvg,        /* Bus current averaged over the PWM period */
         counter,        /* counter */
         status;         /* flag to indicate offset measurement completion */
             
@@ -125,14 +164,33 @@ typedef struct
 
 typedef struct
 {
-    int16_t 
-        sharedCoreChannelNumber;    /* Shared core channel number for switching */
+    uint16_t
+        lowSidePhase[8];    /* Phase connected to DC- in each commutation 
+                               sector : 0 = A, 1 = B, 2 = C */
+    float
+        current;            /* Current of the conducting phases */
+    bool
+        enable,             /* Commutation table is loaded */
+        saturated;          /* Phase current saturated, bus current used */
+}MCAPP_MEASURE_CONDUCTING_T;
+
+typedef struct
+{
+    /* Hot fields : read or written in every control loop interrupt */
+    uint16_t
+        signals;            /* Signals subscribed by any consumer */
     float
         measurePot,         /* Measure potentiometer */
         filterBusCurrent;
     
+    MCAPP_FILTER_LPF_T
+        busCurrentFilter;           /* Bus current low pass filter */
+    
     MCAPP_MEASURE_CURRENT_T
         measureCurrent;             /* Current measurement parameters */
+    
+    MCAPP_MEASURE_CONDUCTING_T
+        conductingCurrent;          /* Current of the conducting phases */
         
     MCAPP_MEASURE_VDC_T
         measureVdc;                 /* DC Bus Sensing parameters */
@@ -141,6 +199,14 @@ typedef struct
         measurePhaseVolt;   /* Phase voltage measurement parameters */
     MCAPP_HALL_SENSOR_T
         detectRotorPosition;/* Rotor position detection from sensors */
+    MCAPP_BEMF_T
+        detectBemf;         /* Rotor position detection from BEMF */
+    
+    /* Cold fields : configuration */
+    int16_t 
+        sharedCoreChannelNumber;    /* Shared core channel number for switching */
+    uint16_t
+        subscription[MEASURE_CONSUMER_COUNT]; /* Signals of each consumer */
 
 }MCAPP_MEASURE_T;
 
@@ -153,6 +219,11 @@ void MCAPP_MeasureCurrentCalibrate (MCAPP_MEASURE_T *);
 void MCAPP_MeasureCurrentInit (MCAPP_MEASURE_T *);
 int16_t MCAPP_MeasureCurrentOffsetStatus (MCAPP_MEASURE_T *);
 void MCAPP_MeasureActualPhaseVoltage(MCAPP_MEASURE_T *);
+void MCAPP_MeasureSubscribe(MCAPP_MEASURE_T *, MCAPP_MEASURE_CONSUMER_T, 
+                                                                uint16_t);
+void MCAPP_MeasureConductingPhaseLoad(MCAPP_MEASURE_T *, const uint32_t *,
+                                        const uint32_t *, const uint32_t *);
+void MCAPP_MeasureConductingCurrent(MCAPP_MEASURE_T *, uint16_t, bool);
 
 void MCAPP_MeasureAvgInit(MCAPP_MEASURE_AVG_T *,uint16_t );
 int16_t MCAPP_MeasureAvg(MCAPP_MEASURE_AVG_T *);
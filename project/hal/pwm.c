@@ -119,6 +119,9 @@ void InitPWMGenerators(void)
     InitPWMGenerator1 ();
     InitPWMGenerator2 ();
     InitPWMGenerator3 (); 
+#if IBUS_OVERSAMPLING > 0
+    InitPWMGenerator4 ();
+#endif
     
     InitDutyPWM123Generators();
 
@@ -130,6 +133,9 @@ void InitPWMGenerators(void)
     /* Enable the PWM module after initializing generators*/
 	PG2CONbits.ON = 1;      
     PG3CONbits.ON = 1;      
+#if IBUS_OVERSAMPLING > 0
+    PG4CONbits.ON = 1;
+#endif
     PG1CONbits.ON = 1;      
 
 }
@@ -339,9 +345,10 @@ void InitPWMGenerator1 (void)
        If OVERENL = 1, then OVRDAT<0> provides data for PWM1L */
     PG1IOCON2bits.OVRDAT = 0;
     /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    PG1IOCON2bits.OSYNC = 0;
+       10 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits occur
+       when specified by the UPDMOD<2:0> bits, the three phases switch on 
+       the master update request */
+    PG1IOCON2bits.OSYNC = 0b10;
     /* Data for PWM1H/PWM1L Pins if FLT Event is Active bits
        If Fault is active, then FLTDAT<1> provides data for PWM1H.
        If Fault is active, then FLTDAT<0> provides data for PWM1L.*/
@@ -719,9 +726,10 @@ void InitPWMGenerator2 (void)
        If OVERENL = 1, then OVRDAT<0> provides data for PWM2L */
     PG2IOCON2bits.OVRDAT = 0;
     /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    PG2IOCON2bits.OSYNC = 0;
+       10 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits occur
+       when specified by the UPDMOD<2:0> bits, the three phases switch on 
+       the master update request */
+    PG2IOCON2bits.OSYNC = 0b10;
     /* Data for PWM2H/PWM2L Pins if FLT Event is Active bits
        If Fault is active, then FLTDAT<1> provides data for PWM2H.
        If Fault is active, then FLTDAT<0> provides data for PWM2L.*/
@@ -1096,9 +1104,10 @@ void InitPWMGenerator3 (void)
        If OVERENL = 1, then OVRDAT<0> provides data for PWM3L */
     PG3IOCON2bits.OVRDAT = 0;
     /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    PG3IOCON2bits.OSYNC = 0;
+       10 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits occur
+       when specified by the UPDMOD<2:0> bits, the three phases switch on 
+       the master update request */
+    PG3IOCON2bits.OSYNC = 0b10;
     /* Data for PWM3H/PWM3L Pins if FLT Event is Active bits
        If Fault is active, then FLTDAT<1> provides data for PWM3H.
        If Fault is active, then FLTDAT<0> provides data for PWM3L.*/
@@ -1389,4 +1398,97 @@ void InitPWMGenerator3 (void)
     
 }
 
+/**
+* <B> Function: InitPWMGenerator4()    </B>
+*
+* @brief Function to configure PWM Module # 4 as the ADC trigger of the bus 
+*        current oversampling. The generator has no output pins, it is 
+*        started by PWM1 and runs IBUS_OVERSAMPLING_FACTOR cycles per PWM 
+*        period, triggering one bus current conversion at each start of cycle.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> InitPWMGenerator4();     </CODE>
+*
+*/
+void InitPWMGenerator4 (void)
+{
+    /* Initialize PWM GENERATOR 4 CONTROL REGISTER */
+    PG4CON      = 0x0000;
+    /* PWM Generator is disabled prior to configuring module */
+    PG4CONbits.ON = 0;
+    /* Clock Selection bits
+       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
+    PG4CONbits.CLKSEL = 1;
+    /* PWM Mode Selection bits
+       000 = Independent Edge PWM mode */
+    PG4CONbits.MODSEL = 0;
+    /* Trigger Count Select bits
+       PWM Generator produces TRGCNT + 1 PWM cycles after triggered */
+    PG4CONbits.TRGCNT = IBUS_OVERSAMPLING_FACTOR - 1;
+    /* Master Period Register Select bit
+       0 = Macro uses the PG4PER register */
+    PG4CONbits.MPERSEL = 0;
+    /* Master Update Enable bit
+       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
+    PG4CONbits.MSTEN = 0;
+    /* PWM Buffer Update Mode Selection bits 
+       Update Data registers at start of next PWM cycle if UPDATE = 1. */
+    PG4CONbits.UPDMOD = 0;
+    /* PWM Generator Trigger Mode Selection bits
+       0b00 = PWM Generator operates in Single Trigger mode */
+    PG4CONbits.TRGMOD = 0;
+    /* Start of Cycle Selection bits
+       0001 = PWM1 trigger o/p selected by PG1 PGTRGSEL<2:0> bits(PGxEVT<2:0>)*/
+    PG4CONbits.SOCS = 1;
+    
+    /* Clear PWM GENERATOR 4 STATUS REGISTER*/
+    PG4STAT      = 0x0000;
+    /* Initialize PWM GENERATOR 4 I/O CONTROL REGISTERS */
+    PG4IOCON1    = 0x0000;
+    PG4IOCON2    = 0x0000;
+    /* PWM4H/PWM4L Output Port Enable bits
+       0 = PWM Generator does not control the output pins */
+    PG4IOCON1bits.PENH = 0;
+    PG4IOCON1bits.PENL = 0;
+    
+    /* Initialize PWM GENERATOR 4 EVENT REGISTERS */
+    PG4EVT1      = 0x0000;
+    PG4EVT2      = 0x0000;
+    /* ADC Trigger 1 Post-scaler Selection bits
+       00000 = 1:1 */
+    PG4EVT1bits.ADTR1PS = 0;
+    /* ADC Trigger 1 Source is PG4TRIGA Compare Event Enable bit
+       1 = PG4TRIGA register compare event is enabled as trigger source for 
+           ADC Trigger 1 */
+    PG4EVT1bits.ADTR1EN1 = 1;
+    /* Interrupt Event Selection bits
+       11 = Time base interrupts are disabled */
+    PG4EVT1bits.IEVTSEL = 3;
+    
+    /* PWM GENERATOR 4 PCI REGISTERS */
+    PG4F1PCI1    = 0x0000;
+    PG4CLPCI1    = 0x0000;
+    PG4F2PCI1    = 0x0000;
+    PG4FFPCI1    = 0x0000;
+    PG4SPCI1     = 0x0000;
+    
+    /* Initialize PWM GENERATOR 4 LEADING-EDGE BLANKING REGISTER */
+    PG4LEB       = 0x0000;
+    
+    /* Initialize PWM GENERATOR 4 PHASE, DUTY CYCLE AND DEAD-TIME REGISTERS */
+    PG4PHASE     = 0x0000;
+    PG4DC        = 0x0000;
+    PG4DCA       = 0x0000;
+    PG4DT        = 0x0000;
+    /* Initialize PWM GENERATOR 4 PERIOD REGISTER */
+    PG4PER       = IBUS_OVERSAMPLING_PERIOD;
+
+    /* Initialize PWM GENERATOR 4 TRIGGER A REGISTER 
+       Conversion at the start of each cycle */
+    PG4TRIGA     = 0x0000;
+}
+
 // </editor-fold>
\ No newline at end of file
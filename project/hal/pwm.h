@@ -71,6 +71,7 @@
 #define PWM_PHASE3                  PG3PHASEbits.PHASE  
         
 #define PCI_FAULT_ACTIVE_STATUS      PG1STATbits.FLTACT        
+#define PCI_CURRENT_LIMIT_ACTIVE_STATUS  PG1STATbits.CLACT
 #define _PWMInterrupt               _PWM1Interrupt
 #define ClearPWMIF()                _PWM1IF = 0 
 #define EnablePWMIF()               _PWM1IE = 1
@@ -90,6 +91,19 @@
 #define LOOPTIME_TCY                        (uint32_t)((LOOPTIME_MICROSEC*8*PWM_CLOCK_MHZ)-16)
 /*Specify ADC Triggering Point w.r.t PWM Output for sensing Analog Inputs*/ 
 #define ADC_SAMPLING_POINT                  (LOOPTIME_TCY/2)
+/*Specify settling time of the bus current after a switching edge*/
+#define ADC_SETTLING_TIME_MICROSEC          1.0f
+/*Specify ADC sampling window of the bus current channel*/
+#define ADC_SAMPLE_WINDOW_MICROSEC          0.25f
+/*ADC sampling window in terms of PWM clock period*/
+#define ADC_SAMPLE_WINDOW_COUNTS            (uint32_t)(ADC_SAMPLE_WINDOW_MICROSEC*16*PWM_CLOCK_MHZ)
+/*Shortest bus current pulse which settles before the sample in its middle*/
+#define ADC_MIN_PULSE_COUNTS                (uint32_t)(((2*ADC_SETTLING_TIME_MICROSEC)+ \
+                                        ADC_SAMPLE_WINDOW_MICROSEC)*16*PWM_CLOCK_MHZ)
+/*Period of PWM Generator 4 triggering the bus current oversampling, 
+  IBUS_OVERSAMPLING_FACTOR edge-aligned cycles per PWM period*/
+#define IBUS_OVERSAMPLING_PERIOD            (uint32_t)(((2*(LOOPTIME_TCY+16))/ \
+                                        IBUS_OVERSAMPLING_FACTOR)-16)
         
 /****Bootstrap Capacitor Charging Parameters*/
 /*Specify bootstrap charging time in Seconds (mention at least 0.01Secs)*/
@@ -113,6 +127,7 @@ void InitPWMGenerators(void);
 void InitPWMGenerator1 (void);
 void InitPWMGenerator2 (void);
 void InitPWMGenerator3 (void);
+void InitPWMGenerator4 (void);
 void InitDutyPWM123Generators(void);
 void InitPWMGenerators(void);   
 void ChargeBootstrapCapacitors(void);
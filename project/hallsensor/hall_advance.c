@@ -0,0 +1,154 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * hall_advance.c
+ *
+ * This file implements the commutation phase advance. The Hall value used
+ * for commutation is switched to the next sector in the direction of rotation
+ * the advance angle before the predicted Hall edge.
+ *
+ *
+ * Component: HALL SENSOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hall_advance.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_HallAdvanceInit(&pAdvance, startSpeed, maxSpeed, 
+*                                                               maxAngle) </B>
+*
+* @brief Function to configure the linear advance angle versus speed.
+*
+* @param Pointer to the data structure containing phase advance parameters.
+* @param Speed to start advancing the commutation.
+* @param Speed at which the maximum advance angle is reached.
+* @param Maximum advance angle in electrical degrees (0 = disabled).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_HallAdvanceInit(&pAdvance, 1750.0f, 3500.0f, 15.0f); </CODE>
+*
+*/
+void MCAPP_HallAdvanceInit(MCAPP_HALL_ADVANCE_T *pAdvance, float startSpeed,
+                                            float maxSpeed, float maxAngle)
+{
+    if(maxAngle > HALL_ADVANCE_LIMIT_DEG)
+    {
+        maxAngle = HALL_ADVANCE_LIMIT_DEG;
+    }
+    pAdvance->startSpeed = startSpeed;
+    pAdvance->maxAngle = maxAngle;
+    if(maxSpeed > startSpeed)
+    {
+        pAdvance->gain = maxAngle / (maxSpeed - startSpeed);
+    }
+    else
+    {
+        pAdvance->gain = 0;
+    }
+    pAdvance->angle = 0;
+    pAdvance->sector = 0;
+    pAdvance->active = 0;
+}
+
+/**
+* <B> Function: MCAPP_HallAdvanceUpdate(&pHallSensor, elapsedTime) </B>
+*
+* @brief Function executed every control loop to set the Hall value used for
+*        commutation. The next Hall edge is predicted one Hall period after
+*        the last Hall edge, the commutation to the next sector is done the
+*        advance angle earlier. The Hall edge commutation is used :
+*        (1) Below the start speed or with advance disabled
+*        (2) Before the Hall sequence is identified
+*        (3) In two sensor operation, where the missing Hall edges are
+*            themselves predicted
+*
+* @param Pointer to the data structure containing hall sensor parameters.
+* @param Time elapsed since the last Hall edge in SCCP Timer counts.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_HallAdvanceUpdate(&pHallSensor, elapsedTime); </CODE>
+*
+*/
+void MCAPP_HallAdvanceUpdate(MCAPP_HALL_SENSOR_T *pHallSensor,
+                                                        uint32_t elapsedTime)
+{
+    MCAPP_HALL_ADVANCE_T *pAdvance = &pHallSensor->advance;
+    MCAPP_HALL_VALIDATOR_T *pValidator = &pHallSensor->validator;
+    MCAPP_CALC_SPEED_T *pCalculateSpeed = &pHallSensor->calculateSpeed;
+    uint32_t advanceTime;
+    uint16_t next;
+
+    pAdvance->sector = pHallSensor->value;
+    pAdvance->active = 0;
+
+    if((pValidator->enable == 0) || (pHallSensor->degraded.active == 1) ||
+            (pCalculateSpeed->period == 0) ||
+            (pCalculateSpeed->speed <= pAdvance->startSpeed))
+    {
+        pAdvance->angle = 0;
+        return;
+    }
+
+    pAdvance->angle =
+            (pCalculateSpeed->speed - pAdvance->startSpeed) * pAdvance->gain;
+    if(pAdvance->angle > pAdvance->maxAngle)
+    {
+        pAdvance->angle = pAdvance->maxAngle;
+    }
+
+    advanceTime = (uint32_t)((float)pCalculateSpeed->period *
+                        (1.0f - (pAdvance->angle / HALL_SECTOR_ANGLE_DEG)));
+    if(elapsedTime >= advanceTime)
+    {
+        if(pHallSensor->direction == 1)
+        {
+            next = pValidator->previousSector[pHallSensor->value & 0x7];
+        }
+        else
+        {
+            next = pValidator->nextSector[pHallSensor->value & 0x7];
+        }
+        if(next != 0)
+        {
+            pAdvance->sector = next;
+            pAdvance->active = 1;
+        }
+    }
+}
+
+// </editor-fold>
@@ -0,0 +1,80 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file hall_advance.h
+ *
+ * @brief This header file lists definitions and interface functions of the
+ * commutation phase advance.
+ *
+ * Note : The commutation is advanced from the Hall edge predicted from the
+ * last Hall period. The advance angle increases linearly with speed from 0 at
+ * PHASE_ADVANCE_START_RPM to PHASE_ADVANCE_MAX_DEG at MAXIMUM_SPEED_RPM, below
+ * PHASE_ADVANCE_START_RPM the motor is commutated on the Hall edges.
+ * The commutation instant is resolved to the control loop period.
+ *
+ * Component: HALL SENSOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef HALL_ADVANCE_H
+#define	HALL_ADVANCE_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hall_sensor_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Electrical angle of one Hall sector (unit : electrical degrees) */
+#define HALL_SECTOR_ANGLE_DEG       60.0f
+/* Advance angle limit, the commutation is not advanced by more than half of
+   a sector (unit : electrical degrees) */
+#define HALL_ADVANCE_LIMIT_DEG      30.0f
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_HallAdvanceInit(MCAPP_HALL_ADVANCE_T *, float, float, float);
+void MCAPP_HallAdvanceUpdate(MCAPP_HALL_SENSOR_T *, uint32_t);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* HALL_ADVANCE_H */
+
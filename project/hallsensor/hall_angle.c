@@ -0,0 +1,159 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * hall_angle.c
+ *
+ * This file implements the rotor angle interpolation between Hall edges. The
+ * angle moves through the present Hall sector at the rate of the last Hall
+ * period and is held at the sector boundary till the next Hall edge.
+ *
+ *
+ * Component: HALL SENSOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hall_angle.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_HallAngleInit(&pAngle) </B>
+*
+* @brief Function to initialize the rotor angle interpolation, the sector
+*        angles are loaded after the Hall sequence identification.
+*
+* @param Pointer to the data structure containing rotor angle parameters.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_HallAngleInit(&pAngle); </CODE>
+*
+*/
+void MCAPP_HallAngleInit(MCAPP_HALL_ANGLE_T *pAngle)
+{
+    uint16_t index;
+
+    for(index = 0; index < 8; index++)
+    {
+        pAngle->sectorAngle[index] = 0;
+    }
+    pAngle->angle = 0;
+    pAngle->enable = 0;
+    pAngle->valid = 0;
+}
+
+/**
+* <B> Function: MCAPP_HallAngleLoad(&pAngle, sectorSequence) </B>
+*
+* @brief Function to load the electrical angle of each Hall sector from the
+*        identified Hall sequence. The n-th Hall value of the sequence was
+*        read with the voltage vector at n x 60 electrical degrees applied.
+*
+* @param Pointer to the data structure containing rotor angle parameters.
+* @param Hall values in the order of the applied voltage vectors.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_HallAngleLoad(&pAngle, sectorSequence); </CODE>
+*
+*/
+void MCAPP_HallAngleLoad(MCAPP_HALL_ANGLE_T *pAngle,
+                                            const uint16_t *sectorSequence)
+{
+    uint16_t vector;
+
+    for(vector = 0; vector < 6; vector++)
+    {
+        pAngle->sectorAngle[sectorSequence[vector] & 0x7] =
+                                    (uint16_t)(((uint32_t)vector << 16) / 6);
+    }
+    pAngle->enable = 1;
+}
+
+/**
+* <B> Function: MCAPP_HallAngleUpdate(&pHallSensor, elapsedTime) </B>
+*
+* @brief Function executed every control loop to interpolate the rotor angle
+*        from the last Hall edge. The angle is not valid :
+*        (1) Before the Hall sequence is identified
+*        (2) In two sensor operation or on Hall failure
+*        (3) Before the first Hall period is measured, or if no Hall edge is
+*            detected for HALL_ANGLE_TIMEOUT_PERIODS Hall periods
+*
+* @param Pointer to the data structure containing hall sensor parameters.
+* @param Time elapsed since the last Hall edge in SCCP Timer counts.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_HallAngleUpdate(&pHallSensor, elapsedTime); </CODE>
+*
+*/
+void MCAPP_HallAngleUpdate(MCAPP_HALL_SENSOR_T *pHallSensor,
+                                                        uint32_t elapsedTime)
+{
+    MCAPP_HALL_ANGLE_T *pAngle = &pHallSensor->rotorAngle;
+    uint32_t period = pHallSensor->calculateSpeed.period;
+    uint16_t sectorAngle, offset;
+
+    pAngle->valid = 0;
+
+    if((pAngle->enable == 0) || (pHallSensor->degraded.active == 1) ||
+            (pHallSensor->hallFailure == 1) || (period == 0) ||
+            (elapsedTime >= (HALL_ANGLE_TIMEOUT_PERIODS * period)))
+    {
+        return;
+    }
+
+    /* The rotor does not leave the sector before the next Hall edge */
+    if(elapsedTime > period)
+    {
+        elapsedTime = period;
+    }
+    offset = (uint16_t)(((float)elapsedTime / (float)period) *
+                                                        HALL_ANGLE_60DEG);
+    sectorAngle = pAngle->sectorAngle[pHallSensor->value & 0x7];
+
+    /* The Hall edge is 30 electrical degrees before the sector middle,
+       the 16 bit angle wraps around at 360 electrical degrees */
+    if(pHallSensor->direction == 1)
+    {
+        pAngle->angle = (uint16_t)(sectorAngle + HALL_ANGLE_30DEG - offset);
+    }
+    else
+    {
+        pAngle->angle = (uint16_t)(sectorAngle - HALL_ANGLE_30DEG + offset);
+    }
+    pAngle->valid = 1;
+}
+
+// </editor-fold>
@@ -0,0 +1,81 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file hall_angle.h
+ *
+ * @brief This header file lists definitions and interface functions of the
+ * rotor angle interpolation between Hall edges.
+ *
+ * Note : The electrical angle of each Hall sector is taken from the Hall
+ * sequence detected by the Hall sequence identifier, the rotor is assumed to
+ * align with the middle of the Hall sector of the applied voltage vector.
+ * The angle is represented as 16 bit unsigned, 65536 = 360 electrical degrees.
+ *
+ * Component: HALL SENSOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef HALL_ANGLE_H
+#define	HALL_ANGLE_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hall_sensor_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* 30 and 60 electrical degrees in 16 bit angle representation */
+#define HALL_ANGLE_30DEG            5461
+#define HALL_ANGLE_60DEG            10923
+/* Time without Hall edge, in Hall periods, after which the interpolated angle
+   is no longer valid */
+#define HALL_ANGLE_TIMEOUT_PERIODS  2
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_HallAngleInit(MCAPP_HALL_ANGLE_T *);
+void MCAPP_HallAngleLoad(MCAPP_HALL_ANGLE_T *, const uint16_t *);
+void MCAPP_HallAngleUpdate(MCAPP_HALL_SENSOR_T *, uint32_t);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* HALL_ANGLE_H */
+
@@ -0,0 +1,280 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * hall_degraded.c
+ *
+ * This file implements the detection of a failed (stuck) Hall input and the
+ * reconstruction of the Hall sector from the two remaining Hall inputs.
+ * The edges of the failed Hall input are replaced by virtual edges generated
+ * one Hall period after the preceding real Hall edge.
+ *
+ *
+ * Component: HALL SENSOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hall_degraded.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_HallDegradedInit(&pDegraded) </B>
+*
+* @brief Function to initialize the Hall degraded operation.
+*        All Hall inputs are considered healthy.
+*
+* @param Pointer to the data structure containing degraded mode parameters.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_HallDegradedInit(&pDegraded); </CODE>
+*
+*/
+void MCAPP_HallDegradedInit(MCAPP_HALL_DEGRADED_T *pDegraded)
+{
+    pDegraded->active       = 0;
+    pDegraded->failedMask   = 0;
+    pDegraded->failedInput  = 0;
+    MCAPP_HallDegradedReset(pDegraded);
+}
+
+/**
+* <B> Function: MCAPP_HallDegradedReset(&pDegraded) </B>
+*
+* @brief Function to reset the run time variables of the Hall degraded
+*        operation. A detected Hall input failure is retained.
+*
+* @param Pointer to the data structure containing degraded mode parameters.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_HallDegradedReset(&pDegraded); </CODE>
+*
+*/
+void MCAPP_HallDegradedReset(MCAPP_HALL_DEGRADED_T *pDegraded)
+{
+    pDegraded->silentEdges[0]   = 0;
+    pDegraded->silentEdges[1]   = 0;
+    pDegraded->silentEdges[2]   = 0;
+    pDegraded->lastCode         = 0;
+    pDegraded->reversalCode     = 0;
+    pDegraded->sector           = 0;
+    pDegraded->lastRealSector   = 0;
+    pDegraded->virtualValue     = 0;
+    pDegraded->direction        = 0;
+    pDegraded->virtualPending   = 0;
+}
+
+/**
+* <B> Function: MCAPP_HallDegradedDetect(&pDegraded, code) </B>
+*
+* @brief Function to detect a failed Hall input. The Hall edges are counted
+*        for each Hall input which does not change. A Hall input which does
+*        not change for HALL_STUCK_EDGE_LIMIT consecutive Hall edges is
+*        declared failed. A reversal (the rotor oscillating between two
+*        sectors) restarts the counting.
+*
+* @param Pointer to the data structure containing degraded mode parameters.
+* @param Hall value read at the Hall edge.
+* @return true if a failed Hall input is detected, else false.
+*
+* @example
+* <CODE> MCAPP_HallDegradedDetect(&pDegraded, code); </CODE>
+*
+*/
+bool MCAPP_HallDegradedDetect(MCAPP_HALL_DEGRADED_T *pDegraded, uint16_t code)
+{
+    uint16_t input, changedInputs = code ^ pDegraded->lastCode;
+
+    for(input = 0; input < 3; input++)
+    {
+        if((code == pDegraded->reversalCode) || (changedInputs & (1 << input)))
+        {
+            pDegraded->silentEdges[input] = 0;
+        }
+        else if(pDegraded->silentEdges[input] < HALL_STUCK_EDGE_LIMIT)
+        {
+            pDegraded->silentEdges[input]++;
+        }
+    }
+    pDegraded->reversalCode = pDegraded->lastCode;
+    pDegraded->lastCode = code;
+
+    for(input = 0; input < 3; input++)
+    {
+        if(pDegraded->silentEdges[input] >= HALL_STUCK_EDGE_LIMIT)
+        {
+            pDegraded->failedMask = (1 << input);
+            pDegraded->failedInput = input + 1;
+            pDegraded->virtualPending = 0;
+            pDegraded->active = 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+* <B> Function: MCAPP_HallDegradedSync(&pDegraded, code) </B>
+*
+* @brief Function to set the reconstructed Hall value from a Hall value with
+*        a failed Hall input. If both values of the failed Hall input give a
+*        valid Hall value, the one with the failed input cleared is used.
+*
+* @param Pointer to the data structure containing degraded mode parameters.
+* @param Hall value read from the Hall inputs.
+* @return Reconstructed Hall value.
+*
+* @example
+* <CODE> MCAPP_HallDegradedSync(&pDegraded, code); </CODE>
+*
+*/
+uint16_t MCAPP_HallDegradedSync(MCAPP_HALL_DEGRADED_T *pDegraded, uint16_t code)
+{
+    uint16_t sector = code & ~pDegraded->failedMask;
+
+    if(sector == 0)
+    {
+        sector = pDegraded->failedMask;
+    }
+    pDegraded->sector = sector;
+    pDegraded->lastRealSector = sector;
+    pDegraded->virtualPending = 0;
+
+    return sector;
+}
+
+/**
+* <B> Function: MCAPP_HallDegradedEdge(&pDegraded, &pValidator, code) </B>
+*
+* @brief Function to reconstruct the Hall value on an edge of a healthy Hall
+*        input. The new sector is the first sector, one or two steps from the
+*        sector of the previous real edge in either direction, which matches
+*        the healthy Hall inputs. If the following edge belongs to the failed
+*        Hall input, a virtual edge is scheduled.
+*        If no sector matches, the Hall value is resynchronized.
+*
+* @param Pointer to the data structure containing degraded mode parameters.
+* @param Pointer to the validator containing the Hall transition table.
+* @param Hall value read at the Hall edge.
+* @return Number of sectors moved since the previous real edge (1 or 2),
+*         0 if the Hall edge does not match the Hall sequence.
+*
+* @example
+* <CODE> MCAPP_HallDegradedEdge(&pDegraded, &pValidator, code); </CODE>
+*
+*/
+uint16_t MCAPP_HallDegradedEdge(MCAPP_HALL_DEGRADED_T *pDegraded,
+                    const MCAPP_HALL_VALIDATOR_T *pValidator, uint16_t code)
+{
+    uint16_t steps, next, healthyCode = code & ~pDegraded->failedMask;
+    uint16_t forward = pDegraded->lastRealSector;
+    uint16_t backward = pDegraded->lastRealSector;
+
+    for(steps = 1; steps <= 2; steps++)
+    {
+        forward = pValidator->nextSector[forward];
+        backward = pValidator->previousSector[backward];
+
+        if((forward != 0) &&
+                ((forward & ~pDegraded->failedMask) == healthyCode))
+        {
+            pDegraded->sector = forward;
+            pDegraded->direction = 0;
+            break;
+        }
+        if((backward != 0) &&
+                ((backward & ~pDegraded->failedMask) == healthyCode))
+        {
+            pDegraded->sector = backward;
+            pDegraded->direction = 1;
+            break;
+        }
+    }
+
+    if(steps > 2)
+    {
+        MCAPP_HallDegradedSync(pDegraded, code);
+        return 0;
+    }
+
+    pDegraded->lastRealSector = pDegraded->sector;
+
+    /* Schedule a virtual edge if the next sector in the direction of
+       rotation is reached by an edge of the failed Hall input */
+    if(pDegraded->direction == 0)
+    {
+        next = pValidator->nextSector[pDegraded->sector];
+    }
+    else
+    {
+        next = pValidator->previousSector[pDegraded->sector];
+    }
+    pDegraded->virtualValue = next;
+    pDegraded->virtualPending =
+                        ((next ^ pDegraded->sector) == pDegraded->failedMask);
+
+    return steps;
+}
+
+/**
+* <B> Function: MCAPP_HallDegradedVirtualEdge(&pDegraded, elapsedTime,
+*                                                               period) </B>
+*
+* @brief Function to generate the pending virtual edge of the failed Hall
+*        input once one Hall period has elapsed after the last real edge.
+*
+* @param Pointer to the data structure containing degraded mode parameters.
+* @param Time elapsed since the last real Hall edge in SCCP Timer counts.
+* @param Hall period in SCCP Timer counts.
+* @return true if the virtual edge is generated, else false.
+*
+* @example
+* <CODE> MCAPP_HallDegradedVirtualEdge(&pDegraded, elapsed, period); </CODE>
+*
+*/
+bool MCAPP_HallDegradedVirtualEdge(MCAPP_HALL_DEGRADED_T *pDegraded,
+                                        uint32_t elapsedTime, uint32_t period)
+{
+    if((pDegraded->virtualPending == 0) || (period == 0) ||
+                                                    (elapsedTime < period))
+    {
+        return false;
+    }
+    pDegraded->sector = pDegraded->virtualValue;
+    pDegraded->virtualPending = 0;
+
+    return true;
+}
+
+// </editor-fold>
@@ -0,0 +1,82 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file hall_degraded.h
+ *
+ * @brief This header file lists definitions and interface functions of the
+ * Hall sensor degraded (two sensor) operation.
+ *
+ * Note : The missing Hall edges of a failed Hall input are reconstructed
+ * from the Hall sequence detected by the Hall sequence identifier, hence the
+ * degraded operation is possible only after the identification is completed.
+ *
+ * Component: HALL SENSOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef HALL_DEGRADED_H
+#define	HALL_DEGRADED_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hall_sensor_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Number of consecutive Hall edges without a change of one Hall input which
+   declares the Hall input failed. In normal operation each Hall input
+   changes on every third Hall edge */
+#define HALL_STUCK_EDGE_LIMIT       3
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_HallDegradedInit(MCAPP_HALL_DEGRADED_T *);
+void MCAPP_HallDegradedReset(MCAPP_HALL_DEGRADED_T *);
+bool MCAPP_HallDegradedDetect(MCAPP_HALL_DEGRADED_T *, uint16_t);
+uint16_t MCAPP_HallDegradedSync(MCAPP_HALL_DEGRADED_T *, uint16_t);
+uint16_t MCAPP_HallDegradedEdge(MCAPP_HALL_DEGRADED_T *,
+                                    const MCAPP_HALL_VALIDATOR_T *, uint16_t);
+bool MCAPP_HallDegradedVirtualEdge(MCAPP_HALL_DEGRADED_T *, uint32_t, uint32_t);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* HALL_DEGRADED_H */
+
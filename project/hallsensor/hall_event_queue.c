@@ -0,0 +1,143 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * hall_event_queue.c
+ *
+ * This file implements the lock-free queue used to pass Hall edge events
+ * (time stamp and Hall code) from the Hall sensor interrupt to the control
+ * interrupt.
+ *
+ *
+ * Component: HALL SENSOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hall_event_queue.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_HallEventQueueReset(&pQueue) </B>
+*
+* @brief Function to empty the Hall event queue from the consumer side, the
+*        queued events are discarded. Only the tail is written, so it may be
+*        called while the Hall sensor interrupt pushes events. The overflow
+*        counter is written only by the producer and is kept, it starts from 
+*        0 with the cleared application data.
+*
+* @param Pointer to the Hall event queue.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_HallEventQueueReset(&pQueue); </CODE>
+*
+*/
+void MCAPP_HallEventQueueReset(MCAPP_HALL_EVENT_QUEUE_T *pQueue)
+{
+    pQueue->tail = pQueue->head;
+}
+
+/**
+* <B> Function: MCAPP_HallEventQueuePush(&pQueue, &pEvent) </B>
+*
+* @brief Function to add a Hall edge event to the queue.
+*        Called only from the Hall sensor interrupt (producer).
+*        If the queue is full the event is dropped and the overflow counter
+*        is incremented.
+*
+* @param Pointer to the Hall event queue.
+* @param Pointer to the Hall edge event.
+* @return true if the event is queued, false on overflow.
+*
+* @example
+* <CODE> MCAPP_HallEventQueuePush(&pQueue, &event); </CODE>
+*
+*/
+bool MCAPP_HallEventQueuePush(MCAPP_HALL_EVENT_QUEUE_T *pQueue,
+                                            const MCAPP_HALL_EVENT_T *pEvent)
+{
+    uint16_t head = pQueue->head;
+    volatile MCAPP_HALL_EVENT_T *pSlot;
+
+    if((uint16_t)(head - pQueue->tail) >= HALL_EVENT_QUEUE_SIZE)
+    {
+        pQueue->overflowCount++;
+        return false;
+    }
+
+    pSlot = &pQueue->event[head & HALL_EVENT_QUEUE_MASK];
+    pSlot->timestamp = pEvent->timestamp;
+    pSlot->code = pEvent->code;
+    /* Publish the event only after it is completely written, the volatile 
+       slot and head stores are not reordered by the compiler */
+    pQueue->head = head + 1;
+
+    return true;
+}
+
+/**
+* <B> Function: MCAPP_HallEventQueuePop(&pQueue, &pEvent) </B>
+*
+* @brief Function to remove the oldest Hall edge event from the queue.
+*        Called only from the control interrupt (consumer).
+*
+* @param Pointer to the Hall event queue.
+* @param Pointer to store the Hall edge event.
+* @return true if an event is read, false if the queue is empty.
+*
+* @example
+* <CODE> MCAPP_HallEventQueuePop(&pQueue, &event); </CODE>
+*
+*/
+bool MCAPP_HallEventQueuePop(MCAPP_HALL_EVENT_QUEUE_T *pQueue,
+                                                    MCAPP_HALL_EVENT_T *pEvent)
+{
+    uint16_t tail = pQueue->tail;
+    volatile MCAPP_HALL_EVENT_T *pSlot;
+
+    if(tail == pQueue->head)
+    {
+        return false;
+    }
+
+    pSlot = &pQueue->event[tail & HALL_EVENT_QUEUE_MASK];
+    pEvent->timestamp = pSlot->timestamp;
+    pEvent->code = pSlot->code;
+    /* Release the slot only after the event is copied */
+    pQueue->tail = tail + 1;
+
+    return true;
+}
+
+// </editor-fold>
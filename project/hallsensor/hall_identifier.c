@@ -69,6 +69,18 @@ const uint32_t bldcVector3[6]	=	{DC_MINUS,PWM_OFF ,DC_PLUS ,DC_PLUS ,PWM_OFF ,DC
 const uint32_t bldcVector2[6]	=	{DC_PLUS ,DC_PLUS ,PWM_OFF ,DC_MINUS,DC_MINUS,PWM_OFF};
 const uint32_t bldcVector1[6]	=	{PWM_OFF ,DC_MINUS,DC_MINUS,PWM_OFF ,DC_PLUS ,DC_PLUS};
 
+/*  Two-phase voltage vector with synchronous rectification, the low side 
+    switch of the DC+ phase is switched complementary to the high side */
+const uint32_t bldcCompVector3[6] = {DC_MINUS_COMPLEMENTARY, PWM_OFF_COMPLEMENTARY,
+                                     DC_PLUS_COMPLEMENTARY,  DC_PLUS_COMPLEMENTARY,
+                                     PWM_OFF_COMPLEMENTARY,  DC_MINUS_COMPLEMENTARY};
+const uint32_t bldcCompVector2[6] = {DC_PLUS_COMPLEMENTARY,  DC_PLUS_COMPLEMENTARY,
+                                     PWM_OFF_COMPLEMENTARY,  DC_MINUS_COMPLEMENTARY,
+                                     DC_MINUS_COMPLEMENTARY, PWM_OFF_COMPLEMENTARY};
+const uint32_t bldcCompVector1[6] = {PWM_OFF_COMPLEMENTARY,  DC_MINUS_COMPLEMENTARY,
+                                     DC_MINUS_COMPLEMENTARY, PWM_OFF_COMPLEMENTARY,
+                                     DC_PLUS_COMPLEMENTARY,  DC_PLUS_COMPLEMENTARY};
+
 
 // </editor-fold>
 
@@ -128,13 +140,14 @@ void HallSeqIdentifier_Execute(MCAPP_HALLSEQ_IDENT_T* pData, float Ibus)
                                                             pData->pwmPeriod)); 
 
         /* Load the duty cycle */
-        HAL_PWM_DutyCycleRegister_Set(pData->dutyCycle);
+        HAL_PWM_DutyCycleRegister_Set(pData->pHal, pData->dutyCycle);
 
         /* Load the voltage vector to corresponding PWM registers of each phase 
            of three phase inverter */      
-        PWM3_OverrideEnableDataSet(SVMvector3[pData->vector]);
-        PWM2_OverrideEnableDataSet(SVMvector2[pData->vector]);
-        PWM1_OverrideEnableDataSet(SVMvector1[pData->vector]); 
+        HAL_PWMOverrideEnableDataSet(pData->pHal, 2, SVMvector3[pData->vector]);
+        HAL_PWMOverrideEnableDataSet(pData->pHal, 1, SVMvector2[pData->vector]);
+        HAL_PWMOverrideEnableDataSet(pData->pHal, 0, SVMvector1[pData->vector]); 
+        HAL_PWMUpdateRequest(pData->pHal);
         
         /* Increment the interval counter */
         pData->intervalCount++;  
@@ -155,14 +168,21 @@ void HallSeqIdentifier_Execute(MCAPP_HALLSEQ_IDENT_T* pData, float Ibus)
                 /* Failure in hall sequence detection */
                 pData->failure = 1;
             }
-            /* Loading the hall sensor values into an array for reference */
-            pData->sectorSequence[pData->hallSector] = pData->hallSector; 
+            /* Loading the hall sensor values into an array in the order 
+               of the applied voltage vectors (forward rotation) */
+            pData->sectorSequence[pData->vector] = pData->hallSector; 
             
             /* Load the PWM override data based on the hall sequence for 
                trapezoidal commutation. */
             pData->ovrDataOutPWM3[pData->hallSector] = bldcVector3[pData->vector];
             pData->ovrDataOutPWM2[pData->hallSector] = bldcVector2[pData->vector];
             pData->ovrDataOutPWM1[pData->hallSector] = bldcVector1[pData->vector];
+            pData->ovrCompDataOutPWM3[pData->hallSector] = 
+                                            bldcCompVector3[pData->vector];
+            pData->ovrCompDataOutPWM2[pData->hallSector] = 
+                                            bldcCompVector2[pData->vector];
+            pData->ovrCompDataOutPWM1[pData->hallSector] = 
+                                            bldcCompVector1[pData->vector];
             
             /* Increment Vector index for next voltage vector. */
             pData->vector++; 
@@ -176,7 +196,7 @@ void HallSeqIdentifier_Execute(MCAPP_HALLSEQ_IDENT_T* pData, float Ibus)
         /* Indicates the execution is completed.  */
         pData->executionFlag = 1; 
         /* Disable PWM outputs. */
-        HAL_MC1PWMDisableOutputs(); 
+        HAL_PWMDisableOutputs(pData->pHal); 
     }
 
 }
@@ -45,6 +45,7 @@ extern "C" {
 #include <stdbool.h>
 #include "hall_sensor_types.h" 
 #include "pi.h"
+#include "hal_binding_types.h"
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
@@ -66,7 +67,15 @@ typedef struct
         /* PWM override data obtained from the identified hall sequence for the motor */
         ovrDataOutPWM3[7],
         ovrDataOutPWM2[7],
-        ovrDataOutPWM1[7];        
+        ovrDataOutPWM1[7],
+        /* PWM override data for complementary (synchronous rectification) 
+           trapezoidal commutation */
+        ovrCompDataOutPWM3[7],
+        ovrCompDataOutPWM2[7],
+        ovrCompDataOutPWM1[7];
+    
+    const MCAPP_HAL_T
+        *pHal;      /* Peripherals driven by this instance */
     
     bool
         status, /* status of hall sequence identifier */ 
@@ -44,8 +44,22 @@
 #include "hall_sensor.h"
 #include "mc1_user_params.h"
 #include "filter.h"
+#include "hall_event_queue.h"
+#include "hall_validator.h"
+#include "hall_degraded.h"
+#include "hall_advance.h"
+#include "hall_angle.h"
 // </editor-fold> 
 
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static void MCAPP_HallSensorEdgeProcess(MCAPP_HALL_SENSOR_T *,
+                                                const MCAPP_HALL_EVENT_T *);
+static void MCAPP_HallSensorDegradedEdgeProcess(MCAPP_HALL_SENSOR_T *,
+                                                const MCAPP_HALL_EVENT_T *);
+
+// </editor-fold>
+
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
 
 /**
@@ -63,15 +77,31 @@
 void MCAPP_HallSensorInit(MCAPP_HALL_SENSOR_T *pHallsensor)
 {
     pHallsensor->calculateSpeed.avgPeriod   = 0;
+    MCAPP_MovingAvgFilterInit(&pHallsensor->calculateSpeed.periodFilter, 
+                                                            AVGFILTER_SCALER);
     pHallsensor->calculateSpeed.speed       = 0;
     pHallsensor->calculateSpeed.period      = 0;
     pHallsensor->calculateSpeed.previousTimerValue = 0;
     pHallsensor->calculateSpeed.presentTimerValue  = 0;
     pHallsensor->calculateSpeed.timerValue  = 0;
+    pHallsensor->calculateSpeed.newSample   = 0;
     pHallsensor->hallChangeDetected         = 0;
     pHallsensor->value                      = 0;
     pHallsensor->presentValue               = 0;
     pHallsensor->previousValue              = 0;
+    pHallsensor->direction                  = 0;
+    pHallsensor->advance.sector             = 0;
+    pHallsensor->rotorAngle.valid           = 0;
+    pHallsensor->missedEdgeCount            = 0;
+    /* The Hall odometer is kept, the rotor position is not lost while the 
+       motor is stopped or changes direction */
+    /* The validator tables are kept, they are loaded by the identifier */
+    pHallsensor->validator.anomalyCount     = 0;
+    pHallsensor->validator.rejectedValue    = 0;
+    /* A failed Hall input detected earlier is retained */
+    MCAPP_HallDegradedReset(&pHallsensor->degraded);
+    /* Events queued before the initialization are discarded */
+    MCAPP_HallEventQueueReset(&pHallsensor->eventQueue);
 }
 
 /**
@@ -136,6 +166,13 @@ void MCAPP_HallSensorValue(MCAPP_HALL_SENSOR_T *pHallSensor)
        pHallSensor->previousValue = pHallSensor->previousValue;
        pHallSensor->hallChangeDetected = 0;
     }
+    
+    /* Two sensor operation : resolve the value of the failed Hall input */
+    if(pHallSensor->degraded.active)
+    {
+        pHallSensor->value = MCAPP_HallDegradedSync(&pHallSensor->degraded,
+                                                    pHallSensor->presentValue);
+    }
 }
 
 /**
@@ -154,11 +191,13 @@ void MCAPP_MeasureSpeed(MCAPP_HALL_SENSOR_T *pHallSensor)
 {   
     MCAPP_CALC_SPEED_T *pCalculateSpeed = &pHallSensor->calculateSpeed;
     
+    pCalculateSpeed->newSample = pCalculateSpeed->startFlag;
     /* Calculating Speed using the period */
     if(pCalculateSpeed->startFlag == 1)
     {
        /* Calculating Moving Average of Period */
-        pCalculateSpeed->avgPeriod = MCAPP_MovingAvgFilter(pCalculateSpeed->period);
+        pCalculateSpeed->avgPeriod = MCAPP_MovingAvgFilter(
+                    &pCalculateSpeed->periodFilter, pCalculateSpeed->period);
         /* Calculating Speed using the period*/
         if(pCalculateSpeed->avgPeriod != 0)
         {
@@ -229,73 +268,300 @@ void HallSensorDisable(void)
 }
 
 /**
-* <B> Function: HallSensorHandler(void) </B>
+* <B> Function: HallSensorHandler(&pHallSensor) </B>
 *
-* @brief This Function performs the following actions:
-*        (1) Read the Hall sensor value
-*        (2) Checks for Change in Hall sector 
-*        (3) For a change in sector read the Timer value
-*        (4) Use the timer value for speed measurement
-*        (5) Check for incorrect Hall sector values and Timer Failure   
+* @brief This Function is executed in the Hall sensor interrupt and performs 
+*        the following actions:
+*        (1) Read the Timer value to time stamp the Hall edge
+*        (2) Read the Hall sensor value
+*        (3) Push the (time stamp, Hall value) event into the Hall event queue
+*            if the Hall value has changed
+*        The events are processed in the control interrupt by 
+*        MCAPP_HallSensorEventsProcess().
 *        
-* @param none.
+* @param Pointer to the data structure containing hall sensor parameters.
 * @return none.
 * 
 * @example
-* <CODE> HallSensorHandler(); </CODE>
+* <CODE> HallSensorHandler(&pHallSensor); </CODE>
 *
 */ 
 void HallSensorHandler(MCAPP_HALL_SENSOR_T *pHallSensor)
 {
+    MCAPP_HALL_EVENT_T event;
+    
+    /* Store the SCCP Timer Count */
+    event.timestamp = HallStateChangeTimerDataRead();
+    /* Read the Hall pattern */
+    event.code = MCAPP_HallSensorRead(&pHallSensor->hallInput);
+    
+    /* Queue the edge only if the Hall value differs from the last queued value,
+       spurious interrupts without a change in Hall inputs are ignored */
+    if(event.code != pHallSensor->previousValue)
+    {
+        pHallSensor->previousValue = event.code;
+        MCAPP_HallEventQueuePush(&pHallSensor->eventQueue, &event);
+    }
+}
+
+/**
+* <B> Function: MCAPP_HallSensorEventsProcess(&pHallSensor) </B>
+*
+* @brief Function to process all the Hall edge events queued by the Hall 
+*        sensor interrupt since the previous call. 
+*        It is executed in the control interrupt before the Hall sector is 
+*        used for commutation.
+*        
+* @param Pointer to the data structure containing hall sensor parameters.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_HallSensorEventsProcess(&pHallSensor); </CODE>
+*
+*/ 
+void MCAPP_HallSensorEventsProcess(MCAPP_HALL_SENSOR_T *pHallSensor)
+{
+    MCAPP_HALL_EVENT_T event;
     MCAPP_CALC_SPEED_T *pCalculateSpeed = &pHallSensor->calculateSpeed;
+    uint32_t elapsedTime;
     
-    /* Update the Hall pattern */
-    MCAPP_HallSensorValue(pHallSensor);
-    /* Check if the Hall change is detected */
-    if(pHallSensor->hallChangeDetected == 1)
+    while(MCAPP_HallEventQueuePop(&pHallSensor->eventQueue, &event))
     {
-        /* Store the SCCP Timer Count */
-        pCalculateSpeed->presentTimerValue = HallStateChangeTimerDataRead();
-        
-        pCalculateSpeed->timerValue = pCalculateSpeed->presentTimerValue - 
-                                            pCalculateSpeed->previousTimerValue;
-        pCalculateSpeed->previousTimerValue = pCalculateSpeed->presentTimerValue;
-        
-        /* If timer value is rolled over */
-        if(pCalculateSpeed->timerValue < 0)
+        MCAPP_HallSensorEdgeProcess(pHallSensor, &event);
+    }
+    
+    /* Time since the last Hall edge, unsigned difference handles roll over */
+    elapsedTime = HallStateChangeTimerDataRead() - 
+                                        pCalculateSpeed->previousTimerValue;
+    
+    /* Two sensor operation : generate the edge of the failed Hall input 
+       one Hall period after the last real Hall edge */
+    if(pHallSensor->degraded.active)
+    {
+        if(MCAPP_HallDegradedVirtualEdge(&pHallSensor->degraded,
+                elapsedTime, pCalculateSpeed->period))
         {
-            pCalculateSpeed->period = 0xFFFFFFFF - 
-                                                    pCalculateSpeed->timerValue;
+            pHallSensor->presentValue = pHallSensor->degraded.sector;
+            pHallSensor->value = pHallSensor->degraded.sector;
+            pHallSensor->sector = pHallSensor->degraded.sector;
         }
-        else
+    }
+    
+    /* Phase advance : select the Hall value used for commutation */
+    MCAPP_HallAdvanceUpdate(pHallSensor, elapsedTime);
+    
+    /* Rotor angle interpolated from the last Hall edge */
+    MCAPP_HallAngleUpdate(pHallSensor, elapsedTime);
+}
+
+/**
+* <B> Function: MCAPP_HallSensorEdgeProcess(&pHallSensor, &pEvent) </B>
+*
+* @brief This Function performs the following actions for one Hall edge event:
+*        (1) Detect a failed Hall input and switch to two sensor operation
+*        (2) Validate the Hall edge against the identified Hall sequence and
+*            count the sectors moved in the Hall odometer
+*        (3) Update the Hall sector value
+*        (4) Check for Hall edges lost between two events
+*        (5) Use the event time stamp for speed measurement, the time between
+*            two Hall edges is divided by the number of sectors moved
+*        (6) Check for incorrect Hall sector values and Timer Failure   
+*        
+* @param Pointer to the data structure containing hall sensor parameters.
+* @param Pointer to the Hall edge event.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_HallSensorEdgeProcess(&pHallSensor, &event); </CODE>
+*
+*/ 
+static void MCAPP_HallSensorEdgeProcess(MCAPP_HALL_SENSOR_T *pHallSensor,
+                                            const MCAPP_HALL_EVENT_T *pEvent)
+{
+    MCAPP_CALC_SPEED_T *pCalculateSpeed = &pHallSensor->calculateSpeed;
+    MCAPP_HALL_VALIDATOR_T *pValidator = &pHallSensor->validator;
+    MCAPP_HALL_DEGRADED_T *pDegraded = &pHallSensor->degraded;
+    uint16_t changedInputs;
+    int16_t steps = 1;
+    
+    /* Detection of a stuck Hall input requires the identified Hall sequence
+       for the reconstruction of the missing Hall edges */
+    if((pValidator->enable) && (pDegraded->active == 0))
+    {
+        if(MCAPP_HallDegradedDetect(pDegraded, pEvent->code))
         {
-            pCalculateSpeed->period = pCalculateSpeed->timerValue;
+            pDegraded->lastRealSector = pHallSensor->value;
         }
-
-        /* Incorrect timer value */
-        if(pCalculateSpeed->timerValue == 0)
+    }
+    if(pDegraded->active)
+    {
+        MCAPP_HallSensorDegradedEdgeProcess(pHallSensor, pEvent);
+        return;
+    }
+    
+    if(pValidator->enable)
+    {
+        /* Glitch returning to the present sector, nothing to commutate */
+        if(pEvent->code == pHallSensor->value)
+        {
+            return;
+        }
+        /* Reject Hall edges not adjacent to the present sector or too close
+           to the previous edge, the sector and speed are not updated */
+        steps = MCAPP_HallValidatorCheck(pValidator, pHallSensor->value,
+                    pEvent->code,
+                    pEvent->timestamp - pCalculateSpeed->previousTimerValue,
+                    pCalculateSpeed->period, pCalculateSpeed->avgPeriod);
+        if(steps == 0)
         {
-            pHallSensor->timerError = 1;
+            if(pValidator->anomalyCount >= pValidator->anomalyLimit)
+            {
+                pHallSensor->hallFailure = 1;
+            }
+            return;
         }
-        /*  Hall malfunction detection: check if the hall state is 
-          0 or 7 and enable Hall failure flag */
-        if((pHallSensor->value > 0)&&(pHallSensor->value < 7))
+        /* Direction of rotation with respect to the identified sequence and
+           Hall odometer, counted in sectors moved as a resynchronizing edge
+           moves more than one sector */
+        pHallSensor->position += steps;
+        if(steps < 0)
         {
-            pHallSensor->hallFailure = 0;
-            pHallSensor->sector = pHallSensor->value ;
+            pHallSensor->direction = 1;
+            steps = -steps;
         }
         else
+        {
+            pHallSensor->direction = 0;
+        }
+    }
+    
+    /* Hall inputs follow a Gray code, only one input changes per edge. 
+       More than one changed input means edges were lost */
+    changedInputs = pEvent->code ^ pHallSensor->value;
+    changedInputs = (changedInputs & 1) + ((changedInputs >> 1) & 1) + 
+                                                    ((changedInputs >> 2) & 1);
+    if((pHallSensor->value > 0)&&(pHallSensor->value < 7)&&(changedInputs > 1))
+    {
+        pHallSensor->missedEdgeCount += changedInputs - 1;
+    }
+    
+    /* Update the Hall pattern */
+    pHallSensor->presentValue = pEvent->code;
+    pHallSensor->value = pEvent->code;
+    
+    /* Store the SCCP Timer Count */
+    pCalculateSpeed->presentTimerValue = pEvent->timestamp;
+
+    /* Unsigned difference handles the timer roll over */
+    pCalculateSpeed->timerValue = pCalculateSpeed->presentTimerValue - 
+                                        pCalculateSpeed->previousTimerValue;
+    pCalculateSpeed->previousTimerValue = pCalculateSpeed->presentTimerValue;
+    pCalculateSpeed->period = pCalculateSpeed->timerValue / (uint16_t)steps;
+
+    /* Incorrect timer value */
+    if(pCalculateSpeed->timerValue == 0)
+    {
+        pHallSensor->timerError = 1;
+    }
+    /*  Hall malfunction detection: check if the hall state is 
+      0 or 7 and enable Hall failure flag */
+    if((pHallSensor->value > 0)&&(pHallSensor->value < 7))
+    {
+        pHallSensor->hallFailure = 0;
+        pHallSensor->sector = pHallSensor->value ;
+    }
+    else
+    {
+        pHallSensor->hallFailure = 1;
+    }
+
+    /* The start flag is set for speed calculation based on timer period */
+    pCalculateSpeed->startFlag = 1;
+    /*  Set the motor stop counter value */
+    pHallSensor->motorStopCounter = pHallSensor->motorStopValue;
+    /* Set the motor stall counter value */
+    pHallSensor->motorStallCounter = pHallSensor->motorStallValue;
+}
+
+/**
+* <B> Function: MCAPP_HallSensorDegradedEdgeProcess(&pHallSensor, &pEvent) </B>
+*
+* @brief This Function processes one Hall edge event in two sensor operation:
+*        (1) Reconstruct the Hall sector value from the healthy Hall inputs
+*        (2) Use the event time stamp for speed measurement, the time between
+*            two real Hall edges is divided by the number of sectors moved
+*        (3) Count Hall edges which do not match the Hall sequence
+*        (4) Count the sectors moved in the Hall odometer   
+*        
+* @param Pointer to the data structure containing hall sensor parameters.
+* @param Pointer to the Hall edge event.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_HallSensorDegradedEdgeProcess(&pHallSensor, &event); </CODE>
+*
+*/ 
+static void MCAPP_HallSensorDegradedEdgeProcess(
+        MCAPP_HALL_SENSOR_T *pHallSensor, const MCAPP_HALL_EVENT_T *pEvent)
+{
+    MCAPP_CALC_SPEED_T *pCalculateSpeed = &pHallSensor->calculateSpeed;
+    MCAPP_HALL_VALIDATOR_T *pValidator = &pHallSensor->validator;
+    uint16_t steps;
+    
+    steps = MCAPP_HallDegradedEdge(&pHallSensor->degraded, pValidator, 
+                                                                pEvent->code);
+    
+    /* Update the Hall pattern with the reconstructed Hall value */
+    pHallSensor->presentValue = pHallSensor->degraded.sector;
+    pHallSensor->value = pHallSensor->degraded.sector;
+    pHallSensor->sector = pHallSensor->degraded.sector;
+    
+    /* Unsigned difference handles the timer roll over */
+    pCalculateSpeed->presentTimerValue = pEvent->timestamp;
+    pCalculateSpeed->timerValue = pCalculateSpeed->presentTimerValue - 
+                                        pCalculateSpeed->previousTimerValue;
+    pCalculateSpeed->previousTimerValue = pCalculateSpeed->presentTimerValue;
+    
+    if(steps == 0)
+    {
+        /* Hall edge does not match the healthy Hall inputs, the speed is 
+           not updated and consecutive mismatches raise Hall failure */
+        pValidator->rejectCount++;
+        if(pValidator->anomalyCount < pValidator->anomalyLimit)
+        {
+            pValidator->anomalyCount++;
+        }
+        if(pValidator->anomalyCount >= pValidator->anomalyLimit)
         {
             pHallSensor->hallFailure = 1;
         }
-            
-        /* The start flag is set for speed calculation based on timer period */
-        pHallSensor->calculateSpeed.startFlag = 1;
-        /*  Set the motor stop counter value */
-        pHallSensor->motorStopCounter = pHallSensor->motorStopValue;
-        /* Set the motor stall counter value */
-        pHallSensor->motorStallCounter = pHallSensor->motorStallValue;
-        /* Hall Change detection flag is cleared */
-        pHallSensor->hallChangeDetected = 0;
+        return;
+    }
+    pValidator->anomalyCount = 0;
+    
+    /* Hall odometer, the sectors moved include the reconstructed edge of 
+       the failed Hall input */
+    if(pHallSensor->degraded.direction == 0)
+    {
+        pHallSensor->position += steps;
+    }
+    else
+    {
+        pHallSensor->position -= steps;
     }
-}
\ No newline at end of file
+    
+    pCalculateSpeed->period = pCalculateSpeed->timerValue / steps;
+    
+    /* Incorrect timer value */
+    if(pCalculateSpeed->timerValue == 0)
+    {
+        pHallSensor->timerError = 1;
+    }
+    
+    /* The start flag is set for speed calculation based on timer period */
+    pCalculateSpeed->startFlag = 1;
+    /*  Set the motor stop counter value */
+    pHallSensor->motorStopCounter = pHallSensor->motorStopValue;
+    /* Set the motor stall counter value */
+    pHallSensor->motorStallCounter = pHallSensor->motorStallValue;
+}
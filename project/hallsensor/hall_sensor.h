@@ -84,6 +84,7 @@ void MCAPP_MeasureSpeed(MCAPP_HALL_SENSOR_T *);
 void HallSensorEnable(void);
 void HallSensorDisable(void);
 void HallSensorHandler(MCAPP_HALL_SENSOR_T *);
+void MCAPP_HallSensorEventsProcess(MCAPP_HALL_SENSOR_T *);
     
 // </editor-fold>
 #ifdef	__cplusplus
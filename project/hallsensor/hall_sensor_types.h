@@ -45,11 +45,98 @@ extern "C" {
 // <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
 #include <stdint.h>
 #include <stdbool.h>
+
+#include "filter_types.h"
   
 // </editor-fold>
 
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Number of Hall edge events the queue can hold (must be a power of 2) */
+#define HALL_EVENT_QUEUE_SIZE       8
+#define HALL_EVENT_QUEUE_MASK       (HALL_EVENT_QUEUE_SIZE - 1)
+
+// </editor-fold>
+
 // <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
 
+typedef struct
+{
+    uint32_t
+        timestamp;          /* SCCP Timer value captured at the Hall edge */
+    uint16_t
+        code;               /* Hall inputs read at the Hall edge */
+}MCAPP_HALL_EVENT_T;
+
+typedef struct
+{
+    /* Volatile, the event is written before the head is published */
+    volatile MCAPP_HALL_EVENT_T
+        event[HALL_EVENT_QUEUE_SIZE];   /* Hall edge event buffer */
+    volatile uint16_t
+        head,               /* Write index, updated only by the Hall ISR */
+        tail;               /* Read index, updated only by the control ISR */
+    uint16_t
+        overflowCount;      /* Number of events dropped on a full queue */
+}MCAPP_HALL_EVENT_QUEUE_T;
+
+typedef struct
+{
+    uint16_t
+        nextSector[8],      /* Expected Hall value after a forward edge */
+        previousSector[8],  /* Expected Hall value after a reverse edge */
+        anomalyLimit,       /* Consecutive rejections raising Hall failure */
+        anomalyCount,       /* Consecutive rejected Hall edges */
+        rejectedValue,      /* Hall value of the last rejected edge */
+        rejectCount;        /* Total rejected Hall edges */
+    float
+        minDwellFactor,     /* Minimum time in a sector relative to period */
+        accelFactor;        /* Acceleration allowance, shortening of the 
+                               period per period squared (1/counts^2) */
+    bool
+        enable;             /* Transition table is loaded from identifier */
+}MCAPP_HALL_VALIDATOR_T;
+
+typedef struct
+{
+    uint16_t
+        silentEdges[3],     /* Hall edges without a change of each Hall input */
+        lastCode,           /* Hall value of the last Hall edge */
+        reversalCode,       /* Hall value of the Hall edge before the last */
+        failedMask,         /* Hall value bit of the failed Hall input */
+        failedInput,        /* Failed Hall input: 1 = hall_1 .. 3 = hall_3 */
+        sector,             /* Reconstructed Hall value */
+        lastRealSector,     /* Reconstructed Hall value at the last real edge */
+        virtualValue,       /* Hall value after the pending virtual edge */
+        direction;          /* 0 = sequence order, 1 = reverse order */
+    bool
+        active,             /* Running on the two remaining Hall sensors */
+        virtualPending;     /* Edge of the failed Hall input is expected */
+}MCAPP_HALL_DEGRADED_T;
+
+typedef struct
+{
+    uint16_t
+        sector;             /* Hall value used for commutation */
+    float
+        startSpeed,         /* Speed to start advancing the commutation */
+        gain,               /* Advance angle increase per speed unit */
+        maxAngle,           /* Advance angle limit in electrical degrees */
+        angle;              /* Present advance angle in electrical degrees */
+    bool
+        active;             /* Commutation is ahead of the Hall sensors */
+}MCAPP_HALL_ADVANCE_T;
+
+typedef struct
+{
+    uint16_t
+        sectorAngle[8],     /* Rotor angle at the middle of each Hall sector */
+        angle;              /* Interpolated rotor angle, 65536 = 360 degrees */
+    bool
+        enable,             /* Sector angles are loaded from identifier */
+        valid;              /* Interpolated rotor angle can be used */
+}MCAPP_HALL_ANGLE_T;
+
 typedef struct
 {
     uint16_t
@@ -72,7 +159,10 @@ typedef struct
         avgPeriod,          /* Moving average output of period */
         speed;              /* Measured speed */
     bool
-        startFlag;          /* Start Flag is used to detect first hall transition */
+        startFlag,          /* Start Flag is used to detect first hall transition */
+        newSample;          /* Speed calculated from a new period in this loop */
+    MCAPP_FILTER_AVG_T
+        periodFilter;       /* Moving average filter of period */
   
 }MCAPP_CALC_SPEED_T;
 
@@ -86,8 +176,13 @@ typedef struct
         presentValue,       /* Present value of Hall value */
         previousValue,      /* Previous value of Hall value */
         sector,             /* Hall sector number */
-        value;        /* Hall Sequence Value constructed based on Hall inputs */
-             
+        value,        /* Hall Sequence Value constructed based on Hall inputs */
+        direction,          /* Rotation: 0 = sequence order, 1 = reverse */
+        missedEdgeCount;    /* Hall edges lost between two queued events */
+    int32_t
+        position;           /* Hall odometer : sectors moved by the valid 
+                               Hall edges, incremented in sequence order */
+
         
     bool 
         hallChangeDetected, /* Hall sequence change detection flag */
@@ -97,7 +192,17 @@ typedef struct
     MCAPP_HALL_INPUT_T  hallInput;
     
     MCAPP_CALC_SPEED_T calculateSpeed;
-        
+
+    MCAPP_HALL_EVENT_QUEUE_T eventQueue;
+
+    MCAPP_HALL_VALIDATOR_T validator;
+
+    MCAPP_HALL_DEGRADED_T degraded;
+
+    MCAPP_HALL_ADVANCE_T advance;
+
+    MCAPP_HALL_ANGLE_T rotorAngle;
+
 }MCAPP_HALL_SENSOR_T;
 // </editor-fold>
 
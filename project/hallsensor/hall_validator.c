@@ -0,0 +1,286 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * hall_validator.c
+ *
+ * This file implements the Hall transition validator. A Hall edge is
+ * accepted only if the new Hall value is the next or the previous sector of
+ * the identified Hall sequence and the rotor has stayed long enough in the
+ * present sector.
+ *
+ *
+ * Component: HALL SENSOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hall_validator.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+static int16_t MCAPP_HallSectorStep(const MCAPP_HALL_VALIDATOR_T *, uint16_t,
+                                                                    uint16_t);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_HallValidatorInit(&pValidator, anomalyLimit,
+*                                       minDwellFactor, accelFactor) </B>
+*
+* @brief Function to configure the Hall transition validator.
+*        The validator remains disabled until the transition table is loaded.
+*
+* @param Pointer to the data structure containing validator parameters.
+* @param Number of consecutive rejected edges which raises Hall failure.
+* @param Minimum dwell time in a sector as a fraction of the Hall period.
+* @param Acceleration allowance : acceleration / (timer frequency x speed 
+*        x period), the Hall period shortens by this factor x period^2.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_HallValidatorInit(&pValidator, 3, 0.25f, 1.0e-12f); </CODE>
+*
+*/
+void MCAPP_HallValidatorInit(MCAPP_HALL_VALIDATOR_T *pValidator,
+        uint16_t anomalyLimit, float minDwellFactor, float accelFactor)
+{
+    pValidator->anomalyLimit    = anomalyLimit;
+    pValidator->minDwellFactor  = minDwellFactor;
+    pValidator->accelFactor     = accelFactor;
+    pValidator->anomalyCount    = 0;
+    pValidator->rejectCount     = 0;
+    pValidator->rejectedValue   = 0;
+    pValidator->enable          = 0;
+}
+
+/**
+* <B> Function: MCAPP_HallValidatorLoad(&pValidator, pSequence) </B>
+*
+* @brief Function to build the expected next and previous Hall value tables
+*        from the Hall sequence detected by the identifier.
+*
+* @param Pointer to the data structure containing validator parameters.
+* @param Hall values in the order of forward rotation (6 values).
+* @return true if the sequence is a valid Hall sequence, else false.
+*
+* @example
+* <CODE> MCAPP_HallValidatorLoad(&pValidator, sectorSequence); </CODE>
+*
+*/
+bool MCAPP_HallValidatorLoad(MCAPP_HALL_VALIDATOR_T *pValidator,
+                                                    const uint16_t *pSequence)
+{
+    uint16_t index, present, next, changedInputs, usedSectors = 0;
+
+    pValidator->enable = 0;
+
+    for(index = 0; index < 8; index++)
+    {
+        pValidator->nextSector[index] = 0;
+        pValidator->previousSector[index] = 0;
+    }
+
+    for(index = 0; index < 6; index++)
+    {
+        present = pSequence[index];
+        next = pSequence[(index + 1) % 6];
+
+        /* Each of the Hall values 1 to 6 must be present exactly once */
+        if((present == 0) || (present > 6) || (usedSectors & (1 << present)))
+        {
+            return false;
+        }
+        usedSectors |= (1 << present);
+
+        /* Consecutive Hall values must differ in exactly one Hall input */
+        changedInputs = present ^ next;
+        if((changedInputs != 1) && (changedInputs != 2) && (changedInputs != 4))
+        {
+            return false;
+        }
+
+        pValidator->nextSector[present] = next;
+        pValidator->previousSector[next] = present;
+    }
+
+    pValidator->anomalyCount = 0;
+    pValidator->rejectCount = 0;
+    pValidator->rejectedValue = 0;
+    pValidator->enable = 1;
+
+    return true;
+}
+
+/**
+* <B> Function: MCAPP_HallValidatorCheck(&pValidator, presentValue, newValue,
+*                               elapsedTime, lastPeriod, avgPeriod) </B>
+*
+* @brief Function to validate a Hall edge. The edge is rejected if:
+*        (1) The new Hall value is not adjacent to the present sector in the
+*            identified sequence (includes the invalid values 0 and 7)
+*        (2) The time elapsed in the present sector is shorter than the
+*            minimum dwell time. The dwell is computed from the shorter of
+*            the last and the average Hall period, so that the lagging 
+*            average does not reject edges while accelerating, reduced by 
+*            the period shortening at the allowed acceleration
+*        An edge adjacent to the last rejected Hall value is also accepted,
+*        so that the validator resynchronizes after a lost Hall edge or a
+*        rejected real edge. The rotor then moved through the rejected 
+*        value, two or three sectors from the present sector.
+*        Rejected and consecutively rejected edges are counted.
+*
+* @param Pointer to the data structure containing validator parameters.
+* @param Present (last accepted) Hall value.
+* @param New Hall value.
+* @param Time elapsed since the last accepted edge in SCCP Timer counts.
+* @param Last accepted Hall period in SCCP Timer counts.
+* @param Average Hall period in SCCP Timer counts.
+*        A period of 0 disables the dwell check.
+* @return Sectors moved, positive in the sequence order and negative in the
+*         reverse order, 0 if the edge is rejected.
+*
+* @example
+* <CODE> steps = MCAPP_HallValidatorCheck(&pValidator, value, code, 
+*                                       elapsed, period, avgPeriod); </CODE>
+*
+*/
+int16_t MCAPP_HallValidatorCheck(MCAPP_HALL_VALIDATOR_T *pValidator,
+        uint16_t presentValue, uint16_t newValue, uint32_t elapsedTime,
+                                        uint32_t lastPeriod, float avgPeriod)
+{
+    bool accept = false;
+    int16_t steps, rejectedSteps;
+    uint16_t rejectedValue = pValidator->rejectedValue;
+    float period = (float)lastPeriod;
+
+    if(avgPeriod < period)
+    {
+        period = avgPeriod;
+    }
+    /* Shortest period reached from the present speed at the allowed 
+       acceleration : period / (1 + accelFactor x period^2) */
+    period = period / (1.0f + pValidator->accelFactor * period * period);
+
+    /* Invalid Hall values 0 and 7 are never adjacent to any sector */
+    steps = MCAPP_HallSectorStep(pValidator, presentValue, newValue);
+    if((steps != 1) && (steps != -1))
+    {
+        /* Resynchronization : the rotor moved through the rejected value */
+        rejectedSteps = 
+                MCAPP_HallSectorStep(pValidator, presentValue, rejectedValue);
+        steps = MCAPP_HallSectorStep(pValidator, rejectedValue, newValue);
+        if((rejectedSteps != 0) && ((steps == 1) || (steps == -1)))
+        {
+            steps += rejectedSteps;
+        }
+        else
+        {
+            steps = 0;
+        }
+    }
+    if(steps != 0)
+    {
+        /* Glitch rejection : edge too close to the previous accepted edge */
+        accept = ((float)elapsedTime >= (pValidator->minDwellFactor * period));
+    }
+
+    if(accept)
+    {
+        pValidator->anomalyCount = 0;
+        pValidator->rejectedValue = 0;
+    }
+    else
+    {
+        pValidator->rejectedValue = newValue;
+        pValidator->rejectCount++;
+        if(pValidator->anomalyCount < pValidator->anomalyLimit)
+        {
+            pValidator->anomalyCount++;
+        }
+        steps = 0;
+    }
+
+    return steps;
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_HallSectorStep(&pValidator, fromValue, toValue) </B>
+*
+* @brief Function to compute the sectors moved between two Hall values of 
+*        the identified sequence, up to two sectors in either direction.
+*
+* @param Pointer to the data structure containing validator parameters.
+* @param Hall value moved from.
+* @param Hall value moved to.
+* @return Sectors moved, positive in the sequence order and negative in the
+*         reverse order, 0 if the values are equal, invalid or further apart.
+*
+* @example
+* <CODE> steps = MCAPP_HallSectorStep(&pValidator, value, code); </CODE>
+*
+*/
+static int16_t MCAPP_HallSectorStep(const MCAPP_HALL_VALIDATOR_T *pValidator,
+                                        uint16_t fromValue, uint16_t toValue)
+{
+    uint16_t next = pValidator->nextSector[fromValue & 0x7];
+    uint16_t previous = pValidator->previousSector[fromValue & 0x7];
+    
+    /* Tables hold 0 for the invalid Hall values 0 and 7 */
+    if((toValue == 0) || (toValue > 6) || (next == 0))
+    {
+        return 0;
+    }
+    if(toValue == next)
+    {
+        return 1;
+    }
+    if(toValue == previous)
+    {
+        return -1;
+    }
+    if(toValue == pValidator->nextSector[next])
+    {
+        return 2;
+    }
+    if(toValue == pValidator->previousSector[previous])
+    {
+        return -2;
+    }
+    return 0;
+}
+
+// </editor-fold>
@@ -0,0 +1,82 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file hall_validator.h
+ *
+ * @brief This header file lists definitions and interface functions of the
+ * Hall transition validator.
+ *
+ * Note : The transition table is built from the Hall sequence detected by
+ * the Hall sequence identifier, hence the validator is enabled only after
+ * the identification is completed.
+ *
+ * Component: HALL SENSOR
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef HALL_VALIDATOR_H
+#define	HALL_VALIDATOR_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "hall_sensor_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Number of consecutive rejected Hall edges which raises Hall failure */
+#define HALL_ANOMALY_LIMIT          3
+/* Minimum time the rotor must stay in a sector before the next Hall edge is
+   accepted, as a fraction of the shorter of the last and the average Hall 
+   period reduced by the acceleration allowance (0 = disabled) */
+#define HALL_MIN_DWELL_FACTOR       0.25f
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_HallValidatorInit(MCAPP_HALL_VALIDATOR_T *, uint16_t, float, 
+                                                                    float);
+bool MCAPP_HallValidatorLoad(MCAPP_HALL_VALIDATOR_T *, const uint16_t *);
+int16_t MCAPP_HallValidatorCheck(MCAPP_HALL_VALIDATOR_T *, uint16_t, 
+                                        uint16_t, uint32_t, uint32_t, float);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* HALL_VALIDATOR_H */
+
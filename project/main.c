@@ -82,6 +82,7 @@ int main (void)
     
     while(1)
     {
+        MCAPP_MC1ServiceStepMain();
         
 #ifdef ENABLE_DIAGNOSTICS
         DiagnosticsStepMain();
@@ -56,11 +56,31 @@ extern "C" {
 
 // <editor-fold defaultstate="expanded" desc="DEFINITIONS/MACROS ">
 #define MC1_LOOPTIME_SEC            (float)(1.0/PWMFREQUENCY_HZ)
+/* Execution interval of the speed controller, it is executed once in 
+   (CRTL_LOOP_RATE + 2) control loops */
+#define SPEED_LOOPTIME_SEC          (float)((CRTL_LOOP_RATE + 2)*MC1_LOOPTIME_SEC)
+
+/* Torque constant from the line to line BEMF constant (unit : Nm/A) */
+#define MOTOR_TORQUE_CONSTANT_NM_A  (float)(MOTOR_KE_VOLTS_PER_KRPM*60.0f/(2.0f*3.14159265f*1000.0f))
+
+/* Event triggered speed loop timeout in control loops */
+#define SPEED_LOOP_TIMEOUT_COUNTS   (uint32_t)((SPEED_LOOP_TIMEOUT_mSec*0.001f)/MC1_LOOPTIME_SEC)
+
+/* Hall odometer counts per mechanical revolution */
+#define HALL_COUNTS_PER_REV         (6*POLE_PAIRS)
+/* Position settle time in speed controller executions */
+#define POSITION_SETTLE_COUNTS      (uint16_t)((POSITION_SETTLE_mSec*0.001f)/SPEED_LOOPTIME_SEC)
 
 #define ADC_CURRENT_SCALE           (float)(MC1_PEAK_CURRENT/32768.0f)
     
 #define ADC_VOLTAGE_SCALE           (float)(MC1_PEAK_VOLTAGE/MAX_ADC_COUNT)
   
+/* Speed measurement timer counts per control loop */
+#define SPEED_MEASURE_TIMER_LOOPTIME_COUNTS  (uint32_t)((float)(FCY/2)/(float)(SPEED_MEASURE_TIMER_PRESCALER*PWMFREQUENCY_HZ))
+
+/* Acceleration allowance of the Hall dwell check, twice the acceleration of
+   the speed trajectory in RPM per timer count divided by SPEED_MULTIPLIER */
+#define HALL_DWELL_ACCEL_FACTOR     (float)((2.0f*SPEED_TRAJECTORY_ACCEL_RPM_S*SPEED_MEASURE_TIMER_PRESCALER)/((float)(FCY/2)*(float)SPEED_MULTIPLIER))
 /* SPEED MULTIPLIER CALCULATION = (((FCY/2)*60)/(TIMER_PRESCALER*POLEPAIRS*6))  */
 #define SPEED_MULTIPLIER     (uint32_t)(((float)(FCY/2)/(float)(SPEED_MEASURE_TIMER_PRESCALER*POLE_PAIRS*6))*(float)60)     
         
@@ -72,6 +92,25 @@ extern "C" {
 #define MIN_CHANGE_SPEED_SEC  (float)  (60/(POLE_PAIRS*6*(MINIMUM_SPEED_RPM + 1)))
 /* Minimum change direction interval in counts*/
 #define MIN_CHANGE_SPEED_COUNTS ((float)(MIN_CHANGE_SPEED_SEC / MC1_LOOPTIME_SEC))
+/* Dynamic current limit update interval and time at limit in control loops */
+#define CURRENT_LIMIT_UPDATE_COUNTS (uint16_t)(CURRENT_LIMIT_UPDATE_mSec*0.001f/MC1_LOOPTIME_SEC)
+#define CURRENT_LIMIT_TIME_COUNTS   (uint16_t)(CURRENT_LIMIT_TIME_mSec*0.001f/MC1_LOOPTIME_SEC)
+/* Thermal model update interval in control loops */
+#define THERMAL_MODEL_UPDATE_COUNTS (uint16_t)(THERMAL_MODEL_UPDATE_mSec*0.001f/MC1_LOOPTIME_SEC)
+/* Control loop period of the task scheduler (unit : nano seconds) */
+#define SCHEDULER_TICK_nSec         (1000000000UL/PWMFREQUENCY_HZ)
+/* Scheduler budget in SCCP1 timer counts (FCY/2) */
+#define SCHEDULER_BUDGET_COUNTS(nSec) (uint32_t)(((nSec)*(FCY/2000000UL))/1000UL)
+/* Fault retry delays and window in control loops */
+#define FAULT_RETRY_DELAY_COUNTS    (uint32_t)(FAULT_RETRY_DELAY_mSec*0.001f/MC1_LOOPTIME_SEC)
+#define FAULT_RETRY_DELAY_MAX_COUNTS (uint32_t)(FAULT_RETRY_DELAY_MAX_mSec*0.001f/MC1_LOOPTIME_SEC)
+#define FAULT_RETRY_WINDOW_COUNTS   (uint32_t)(FAULT_RETRY_WINDOW_mSec*0.001f/MC1_LOOPTIME_SEC)
+/* Power meter samples per block */
+#define POWER_METER_BLOCK_COUNTS    (uint32_t)(POWER_METER_BLOCK_mSec*0.001f/MC1_LOOPTIME_SEC)
+/* Control loops per second */
+#define CONTROL_LOOPS_PER_SEC       (uint16_t)PWMFREQUENCY_HZ
+/* Comparator reference for PWM Current Limit PCI, DAC counts per amp */
+#define CMP_REF_SCALE               (float)(HALF_ADC_COUNT/MC1_PEAK_CURRENT)
 /* Comparator reference for PWM Current Limit PCI from DC Bus current*/ 
 #define CMP_REF_DCBUS_FAULT         (uint16_t)(((NOMINAL_CURRENT_BUS_RMS*HALF_ADC_COUNT)/MC1_PEAK_CURRENT)+HALF_ADC_COUNT)
 // </editor-fold>
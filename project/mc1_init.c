@@ -47,6 +47,30 @@
 #include "board_service.h"
 #include "mc1_user_params.h"
 #include "mc1_calc_params.h"
+#include "hall_validator.h"
+#include "hall_degraded.h"
+#include "hall_advance.h"
+#include "hall_angle.h"
+#include "trapezoidal_control.h"
+#include "sine_modulation.h"
+#include "speed_trajectory.h"
+#include "position_control.h"
+#include "current_limit.h"
+#include "thermal_model.h"
+#include "power_meter.h"
+#include "load_observer.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+/* Speed foldback of the cycle-by-cycle current limit */
+static const MCAPP_CURRENT_LIMIT_POINT_T currentLimitFoldback[] =
+{
+    {0.0f, CURRENT_LIMIT_START_FACTOR * NOMINAL_CURRENT_BUS_RMS},
+    {CURRENT_LIMIT_FOLDBACK_FACTOR * MAXIMUM_SPEED_RPM, NOMINAL_CURRENT_BUS_RMS},
+    {MAXIMUM_SPEED_RPM, NOMINAL_CURRENT_BUS_RMS},
+};
 
 // </editor-fold>
 
@@ -57,25 +81,28 @@ static void MCAPP_MC1ControlSchemeConfig(MC1APP_DATA_T *);
 // </editor-fold>
 
 /**
-* <B> Function: MCAPP_MC1ParamsInit (MC1APP_DATA_T *)  </B>
+* <B> Function: MCAPP_MC1ParamsInit (MC1APP_DATA_T *, const MCAPP_HAL_T *)  </B>
 *
 * @brief Function to reset variables used for current offset measurement.
 *
 * @param Pointer to the Application data structure required for 
 * controlling motor 1.
+* @param Pointer to the peripherals driven by the motor control instance.
 * @return none.
 * 
 * @example
-* <CODE> MCAPP_MC1ParamsInit(&pMCData); </CODE>
+* <CODE> MCAPP_MC1ParamsInit(&pMCData, &halMC1); </CODE>
 *
 */
-void MCAPP_MC1ParamsInit(MC1APP_DATA_T *pMCData)
+void MCAPP_MC1ParamsInit(MC1APP_DATA_T *pMCData, const MCAPP_HAL_T *pHal)
 {    
     /* Reset all variables in the data structure to '0' */
     memset(pMCData,0,sizeof(MC1APP_DATA_T));
 
-    pMCData->pControlScheme = &pMCData->controlScheme;
-    pMCData->pMotorInputs = &pMCData->motorInputs;
+    /* Bind the instance to its PWM Generators and ADC data registers */
+    pMCData->pHal = pHal;
+    pMCData->controlScheme.pHal = pHal;
+    pMCData->hallSeqIdent.pHal = pHal;
     
     /* Configure Control Scheme */
     MCAPP_MC1ControlSchemeConfig(pMCData);
@@ -102,15 +129,22 @@ void MCAPP_MC1ControlSchemeConfig(MC1APP_DATA_T *pMCData)
     MCAPP_CONTROL_SCHEME_T *pControlScheme;
     MCAPP_MEASURE_T *pMotorInputs;
 
-    pControlScheme = pMCData->pControlScheme;
-    pMotorInputs = pMCData->pMotorInputs;
+    pControlScheme = &pMCData->controlScheme;
+    pMotorInputs = &pMCData->motorInputs;
  
-    /* Configure Inputs */    
-    pControlScheme->pDirectionCmd = &pMCData->directionCmd;
-    pControlScheme->pMeasuredSpeed = 
-                        &pMotorInputs->detectRotorPosition.calculateSpeed.speed;
-    pControlScheme->pSector = &pMotorInputs->detectRotorPosition.value;
-    pControlScheme->pAvgCurrent = &pMotorInputs->filterBusCurrent;
+    /* Configure Inputs, the control inputs are written by 
+       MCAPP_MC1ControlInputsSet. The Hall sequence identifier uses the 
+       filtered bus current */
+#if CURRENT_FEEDBACK == 1
+    MCAPP_MeasureSubscribe(pMotorInputs, MEASURE_CONSUMER_CONTROL, 
+                                                MEASURE_SIGNAL_BUS_CURRENT);
+#elif IBUS_OVERSAMPLING > 0
+    MCAPP_MeasureSubscribe(pMotorInputs, MEASURE_CONSUMER_CONTROL, 
+            (MEASURE_SIGNAL_BUS_CURRENT | MEASURE_SIGNAL_BUS_CURRENT_AVG));
+#else
+    MCAPP_MeasureSubscribe(pMotorInputs, MEASURE_CONSUMER_CONTROL, 
+                                                MEASURE_SIGNAL_BUS_CURRENT);
+#endif
     
     /* Initialize Motor parameters */
     pControlScheme->motor.MaxSpeed        =  MAXIMUM_SPEED_RPM;
@@ -124,10 +158,17 @@ void MCAPP_MC1ControlSchemeConfig(MC1APP_DATA_T *pMCData)
     pControlScheme->ctrlParam.controlLoop = SPEED_CONTROL;
 #elif CLOSED_LOOP == 2
     pControlScheme->ctrlParam.controlLoop = CURRENT_CONTROL;
+#elif CLOSED_LOOP == 3
+    pControlScheme->ctrlParam.controlLoop = POSITION_CONTROL;
 #else 
     pControlScheme->ctrlParam.controlLoop = SPEED_CONTROL;
 #endif       
     pControlScheme->controlLoopRate = CRTL_LOOP_RATE;
+#if PWM_PATTERN == 1
+    pControlScheme->pwmPattern = PWM_PATTERN_COMPLEMENTARY;
+#else
+    pControlScheme->pwmPattern = PWM_PATTERN_INDEPENDENT;
+#endif
     /* Initialize startup parameters */
     pMotorInputs->detectRotorPosition.calculateSpeed.multiplier = 
                                                                SPEED_MULTIPLIER;   
@@ -135,6 +176,119 @@ void MCAPP_MC1ControlSchemeConfig(MC1APP_DATA_T *pMCData)
                                         DIRECTION_CHANGE_SPEED_COUNTS;
     pMotorInputs->detectRotorPosition.motorStallValue = (uint32_t)
                                         MIN_CHANGE_SPEED_COUNTS;
+    /* Initialize Hall transition validator, the transition table is loaded
+       after the Hall sequence identification */
+    MCAPP_HallValidatorInit(&pMotorInputs->detectRotorPosition.validator,
+                            HALL_ANOMALY_LIMIT, HALL_MIN_DWELL_FACTOR,
+                            HALL_DWELL_ACCEL_FACTOR);
+    /* All Hall inputs are healthy on power up */
+    MCAPP_HallDegradedInit(&pMotorInputs->detectRotorPosition.degraded);
+    /* Initialize commutation phase advance */
+    MCAPP_HallAdvanceInit(&pMotorInputs->detectRotorPosition.advance,
+            PHASE_ADVANCE_START_RPM, MAXIMUM_SPEED_RPM, PHASE_ADVANCE_MAX_DEG);
+    /* Initialize rotor angle interpolation, the sector angles are loaded 
+       after the Hall sequence identification */
+    MCAPP_HallAngleInit(&pMotorInputs->detectRotorPosition.rotorAngle);
+    
+    /* Initialize sinusoidal commutation */
+    MCAPP_SineModulationInit(&pControlScheme->sine, COMMUTATION_MODE,
+            SINE_COMMUTATION_ENTRY_RPM, SINE_COMMUTATION_EXIT_RPM);
+    pControlScheme->sine.pAngle = 
+                        &pMotorInputs->detectRotorPosition.rotorAngle.angle;
+    pControlScheme->sine.pAngleValid = 
+                        &pMotorInputs->detectRotorPosition.rotorAngle.valid;
+    pControlScheme->sine.pAdvanceAngle = 
+                        &pMotorInputs->detectRotorPosition.advance.angle;
+    
+    /* Initialize BEMF zero crossing detection, the commutation order is 
+       loaded after the Hall sequence identification */
+    pMotorInputs->detectBemf.pVa = &pMotorInputs->measurePhaseVolt.Va;
+    pMotorInputs->detectBemf.pVb = &pMotorInputs->measurePhaseVolt.Vb;
+    pMotorInputs->detectBemf.pVc = &pMotorInputs->measurePhaseVolt.Vc;
+    pMotorInputs->detectBemf.pVdc = &pMotorInputs->measureVdc.count;
+    pMotorInputs->detectBemf.pSector = &pMotorInputs->detectRotorPosition.value;
+    pMotorInputs->detectBemf.pDirectionCmd = &pMCData->directionCmd;
+    pMotorInputs->detectBemf.pHallEdgeTime = 
+        &pMotorInputs->detectRotorPosition.calculateSpeed.previousTimerValue;
+    pMotorInputs->detectBemf.multiplier = SPEED_MULTIPLIER;
+    pMotorInputs->detectBemf.samplePeriod = SPEED_MEASURE_TIMER_LOOPTIME_COUNTS;
+    pMotorInputs->detectBemf.blankingMin = 
+            BEMF_BLANKING_MIN_SAMPLES * SPEED_MEASURE_TIMER_LOOPTIME_COUNTS;
+    
+    /* Initialize speed reference trajectory, updated at the speed 
+       controller rate */
+    MCAPP_SpeedTrajectoryInit(&pControlScheme->speedTrajectory, 
+                            SPEED_TRAJECTORY_ACCEL_RPM_S, 
+                            SPEED_TRAJECTORY_JERK_RPM_S2, SPEED_LOOPTIME_SEC);
+    
+    /* Initialize position control on the Hall odometer, updated at the 
+       speed controller rate */
+    MCAPP_PositionControlInit(&pControlScheme->position, 
+                &pMotorInputs->detectRotorPosition.position, 
+                HALL_COUNTS_PER_REV, SPEED_LOOPTIME_SEC);
+    MCAPP_PositionProfileSet(&pControlScheme->position, 
+            POSITION_MOVE_SPEED_RPM, POSITION_MOVE_ACCEL_RPM_S, POSITION_KP,
+            POSITION_WINDOW_COUNTS, POSITION_SETTLE_COUNTS);
+    
+    /* Initialize dynamic current limit */
+    MCAPP_CurrentLimitInit(&pMCData->currentLimit, currentLimitFoldback,
+            sizeof(currentLimitFoldback)/sizeof(currentLimitFoldback[0]),
+            OC_FAULT_LIMIT_DCBUS);
+    pMCData->currentLimit.pSpeed = 
+                        &pMotorInputs->detectRotorPosition.calculateSpeed.speed;
+    pMCData->currentLimit.limitStep = 
+                CURRENT_LIMIT_SLEW_AMPS_S * CURRENT_LIMIT_UPDATE_mSec * 0.001f;
+    pMCData->currentLimit.timeAtLimitMax = CURRENT_LIMIT_TIME_COUNTS;
+    pMCData->currentLimit.timeFactor = CURRENT_LIMIT_TIME_FACTOR;
+    pMCData->currentLimit.secondCount = CONTROL_LOOPS_PER_SEC;
+    pMCData->currentLimit.dacScale = CMP_REF_SCALE;
+    pMCData->currentLimit.dacOffset = HALF_ADC_COUNT;
+    
+    /* Thermal model of the winding and the inverter, the current limit is 
+       derated with its temperature estimate */
+    MCAPP_ThermalModelInit(&pMCData->thermalModel);
+    MCAPP_ThermalNetworkSet(&pMCData->thermalModel.winding, 
+            WINDING_THERMAL_TIME_CONSTANT_SEC, NOMINAL_CURRENT_BUS_RMS, 
+            THERMAL_MODEL_UPDATE_mSec * 0.001f);
+    MCAPP_ThermalNetworkSet(&pMCData->thermalModel.inverter, 
+            INVERTER_THERMAL_TIME_CONSTANT_SEC, INVERTER_CONTINUOUS_CURRENT, 
+            THERMAL_MODEL_UPDATE_mSec * 0.001f);
+    pMCData->thermalModel.boostCurrent = 
+                        CURRENT_LIMIT_START_FACTOR * NOMINAL_CURRENT_BUS_RMS;
+    pMCData->thermalModel.deratingStart = THERMAL_DERATING_START;
+    pMCData->thermalModel.tripLevel = THERMAL_TRIP_LEVEL;
+    MCAPP_CurrentLimitDeratingSet(&pMCData->currentLimit, 
+            &pMCData->thermalModel.temperature, THERMAL_DERATING_START, 
+            THERMAL_DERATING_END, THERMAL_DERATING_MIN_FACTOR);
+    
+    /* Input power from the DC bus voltage and the filtered bus current 
+       during the PWM on time scaled with the duty ratio */
+    MCAPP_PowerMeterInit(&pMCData->powerMeter, POWER_METER_BLOCK_COUNTS, 
+                                                            MC1_LOOPTIME_SEC);
+    pMCData->powerMeter.pVdc = &pMotorInputs->measureVdc.value;
+    pMCData->powerMeter.pCurrent = &pMotorInputs->filterBusCurrent;
+    pMCData->powerMeter.pSpeed = 
+                        &pMotorInputs->detectRotorPosition.calculateSpeed.speed;
+    pMCData->powerMeter.pDuty = &pControlScheme->pwmDuty;
+    pMCData->powerMeter.dutyScale = 1.0f / (float)LOOPTIME_TCY;
+    pMCData->powerMeter.ke = MOTOR_KE_VOLTS_PER_KRPM * 0.001f;
+    pMCData->powerMeter.minPower = POWER_METER_MIN_POWER_W;
+    MCAPP_MeasureSubscribe(pMotorInputs, MEASURE_CONSUMER_METERING, 
+                    (MEASURE_SIGNAL_BUS_VOLTAGE | MEASURE_SIGNAL_BUS_CURRENT));
+    
+    /* Initialize load torque observer, updated every control loop */
+    MCAPP_LoadObserverInit(&pControlScheme->loadObserver, 
+            MOTOR_TORQUE_CONSTANT_NM_A, 
+            (MOTOR_INERTIA_KGM2 + LOAD_INERTIA_KGM2), MOTOR_RESISTANCE_LL_OHM,
+            MC1_LOOPTIME_SEC);
+    MCAPP_LoadObserverBandwidthSet(&pControlScheme->loadObserver, 
+                                            LOAD_OBSERVER_BANDWIDTH_RAD_S);
+#ifdef LOAD_OBSERVER
+    pControlScheme->loadObserver.feedForwardGain = LOAD_OBSERVER_FF_GAIN;
+    pControlScheme->loadObserver.enable = 1;
+    MCAPP_MeasureSubscribe(pMotorInputs, MEASURE_CONSUMER_OBSERVER, 
+                                                MEASURE_SIGNAL_BUS_VOLTAGE);
+#endif
     
     /* Initialize PI controller used for current control */
     pControlScheme->piCurrent.param.kp        =   CURRCNTR_PTERM;
@@ -146,6 +300,14 @@ void MCAPP_MC1ControlSchemeConfig(MC1APP_DATA_T *pMCData)
     pControlScheme->piSpeed.param.ki          =   SPEEDCNTR_ITERM;
     pControlScheme->piSpeed.param.outMax      =   SPEEDCNTR_OUTMAX;
     pControlScheme->piSpeed.param.outMin      =   SPEEDCNTR_OUTMIN;
+    /* The integral gain is set for the fixed rate speed loop */
+#if SPEED_LOOP_MODE == 1
+    MCAPP_SpeedLoopModeSet(pControlScheme, SPEED_LOOP_EVENT, 
+                                                SPEED_LOOP_TIMEOUT_COUNTS);
+#else
+    MCAPP_SpeedLoopModeSet(pControlScheme, SPEED_LOOP_FIXED_RATE, 
+                                                SPEED_LOOP_TIMEOUT_COUNTS);
+#endif
     
     /* Output Initializations */
     pControlScheme->pwmPeriod = LOOPTIME_TCY; 
@@ -54,12 +54,20 @@ extern "C" {
 #include "trapezoidal_types.h"
 #include "board_service.h"
 #include "hall_identifier.h"
+#include "current_limit_types.h"
+#include "thermal_model_types.h"
+#include "power_meter_types.h"
+#include "state_engine_types.h"
+#include "fault_manager_types.h"
     
 // </editor-fold>
    
 // <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
     
 #define MCAPP_CONTROL_SCHEME_T              MCAPP_BLDC_TRAPEZOIDAL_CONTROL_T
+/* Alignment of the hot block of the application data and of the control and
+   measurement data, each starting with its hot fields (bytes) */
+#define MC_HOT_BLOCK_ALIGN                  16
     
 // </editor-fold>
     
@@ -73,9 +81,21 @@ typedef enum
     MCAPP_STOP = 5,                     /* Stop the motor */
     MCAPP_FAULT = 6,                    /* Motor is in Fault mode */
     MCAPP_HALLSEQ_IDENT = 7,         /* Run Hall Phase Sequence Identifier */
+    MCAPP_STATE_COUNT = 8,
 
 }MCAPP_STATE_T;
 
+typedef enum
+{
+    MCAPP_CAUSE_COMPLETE = 1,           /* Work of the state completed */
+    MCAPP_CAUSE_RUN_CMD = 2,            /* Run command */
+    MCAPP_CAUSE_STOP_CMD = 3,           /* Stop command */
+    MCAPP_CAUSE_DIRECTION_CMD = 4,      /* Change direction command */
+    MCAPP_CAUSE_FAULT = 5,              /* Fault, the fault code is traced */
+    MCAPP_CAUSE_RETRY = 6,              /* Retry delay of the fault elapsed */
+
+}MCAPP_TRANSITION_CAUSE_T;
+
 typedef enum
 {
     MCAPP_HALLSEQ_INIT = 0,                     /* Initialize Run time parameters */
@@ -93,39 +113,86 @@ typedef enum
     MCAPP_HALL_FAILURE = 3,             /* Hall sensor feedback fault */
     MCAPP_TIMER_ERROR = 4,              /* Timer value error */
     MCAPP_HALLSEQ_IDENT_FAILURE = 5,    /* Failure in detecting Hall sequence */
+    /* BEMF zero crossings lost while driving the commutation */
+    MCAPP_BEMF_FAILURE = 6,
+    /* Winding or inverter temperature estimate above the trip level */
+    MCAPP_THERMAL_FAULT = 7,
+    MCAPP_FAULT_CODE_COUNT = 8,
 
 }MCAPP_FAULTS_T;
+
+typedef enum
+{
+    /* One Hall input failed, motor runs on two Hall sensors with reduced 
+       speed and current limits (the motor is not stopped) */
+    MCAPP_HALL_DEGRADED = 0x0001,
+    /* Hall sensors failed, motor runs on BEMF zero crossing commutation */
+    MCAPP_BEMF_COMMUTATION = 0x0002,
+
+}MCAPP_RUN_STATUS_T;
     
 // <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
 
 typedef struct
 {
+    /* Hot block : fields of the application read or written in every 
+       control loop interrupt */
+    const MCAPP_HAL_T 
+        *pHal __attribute__((aligned(MC_HOT_BLOCK_ALIGN))); /* Peripherals 
+                                       driven by this instance */
     uint16_t
         appState,                   /* Application State */
         runCmd,                     /* Run command for motor */
-        runCmdBuffer,               /* Run command buffer for validation */
         directionCmd,               /* Direction Change command for motor */
-        directionCmdBuffer,         /* Direction Change command buffer for validation */
-        directionCmdFlag,           /* Flag to indicate change direction command */
-        faultStatus;                /* Fault status */
+        faultRequest;               /* Fault detected outside the state 
+                                       machine, 0 = none */
+    
+    /* Control and measurement data, each starts with the fields of the 
+       control loop followed by its configuration */
+    MCAPP_CONTROL_SCHEME_T
+        controlScheme __attribute__((aligned(MC_HOT_BLOCK_ALIGN))); /* Motor 
+                                       Control parameters */
     
     MCAPP_MEASURE_T
-        motorInputs;
+        motorInputs __attribute__((aligned(MC_HOT_BLOCK_ALIGN)));
     
-    MCAPP_CONTROL_SCHEME_T
-        controlScheme;              /* Motor Control parameters */
+    /* Cold block : commands, configuration and the slower tasks */
+    uint16_t
+        runCmdBuffer,               /* Run command buffer for validation */
+        directionCmdBuffer,         /* Direction Change command buffer for validation */
+        directionCmdFlag,           /* Flag to indicate change direction command */
+        bemfCommutationCmd,         /* Command to commutate on BEMF zero crossings */
+        faultStatus,                /* Fault status */
+        runStatus;                  /* Degraded operation while running,
+                                       bit mask of MCAPP_RUN_STATUS_T */
+    bool
+        degradedLimits;             /* Hall degraded speed and current 
+                                       limits applied */
     
     MCAPP_HALLSEQ_IDENT_T
         hallSeqIdent;               /* Hall sequence identifier parameters */
-    MCAPP_MEASURE_T *pMotorInputs;
-    MCAPP_CONTROL_SCHEME_T *pControlScheme;    
+    
+    MCAPP_CURRENT_LIMIT_T
+        currentLimit;               /* Dynamic current limit parameters */
+    
+    MCAPP_THERMAL_MODEL_T
+        thermalModel;               /* Winding and inverter thermal model */
+    
+    MCAPP_POWER_METER_T
+        powerMeter;                 /* Input power and energy meter */
+    
+    MCAPP_STATE_ENGINE_T
+        stateEngine;                /* Application state machine and trace */
+    
+    MCAPP_FAULT_MANAGER_T
+        faultManager;               /* Fault classification and retry */
 }MC1APP_DATA_T;
 
 // </editor-fold>
     
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
 
-void MCAPP_MC1ParamsInit(MC1APP_DATA_T *);
+void MCAPP_MC1ParamsInit(MC1APP_DATA_T *, const MCAPP_HAL_T *);
 // </editor-fold>
 
 #ifdef __cplusplus
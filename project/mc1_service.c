@@ -38,6 +38,7 @@
 // <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
 
 #include <stdint.h>
+#include <stddef.h>
 #include <stdbool.h>
 
 #include <libq.h>
@@ -46,190 +47,731 @@
 #include "mc1_init.h"
 #include "trapezoidal_control.h"
 #include "mc1_user_params.h"
+#include "mc1_calc_params.h"
+#include "hall_validator.h"
+#include "hall_angle.h"
+#include "speed_trajectory.h"
+#include "position_control.h"
+#include "current_limit.h"
+#include "thermal_model.h"
+#include "power_meter.h"
+#include "scheduler.h"
+#include "state_engine.h"
+#include "fault_manager.h"
+#include "mc1_service.h"
 // </editor-fold>
 
 // <editor-fold defaultstate="expanded" desc="VARIABLES ">
 
-MC1APP_DATA_T mc1;
-MC1APP_DATA_T *pMC1Data = &mc1;
+/* Motor control instances, instance 0 is motor 1 which also owns the Hall 
+   capture, the ADC trigger and the push buttons */
+MC1APP_DATA_T mcInstance[MC_INSTANCE_COUNT];
+MC1APP_DATA_T *pMC1Data = &mcInstance[0];
+
+/* Peripherals of each motor control instance */
+static const MCAPP_HAL_T * const mcInstanceHal[MC_INSTANCE_COUNT] =
+{
+    &halMC1,
+};
+
+/* Task scheduler of each motor control instance and the execution time of 
+   its slots, readable from X2C Scope */
+MCAPP_SCHEDULER_T mcScheduler[MC_INSTANCE_COUNT];
+MCAPP_SCHEDULER_STATUS_T mcSchedulerStatus[MC_INSTANCE_COUNT][MC_SCHEDULER_SLOTS];
 
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
 
-static void MC1APP_StateMachine(MC1APP_DATA_T *);
+static void MCAPP_MC1ControlTask(void *);
+static void MCAPP_MC1CurrentLimitTask(void *);
+static void MCAPP_MC1ThermalTask(void *);
+static uint16_t MC1APP_FaultCheck(void *);
+static void MC1APP_InitEntry(void *);
+static void MC1APP_HallSeqIdentStep(void *);
+static void MC1APP_OffsetEntry(void *);
+static void MC1APP_OffsetStep(void *);
+static void MC1APP_RunEntry(void *);
+static void MC1APP_RunStep(void *);
+static void MC1APP_DirectionChangeStep(void *);
+static void MC1APP_DirectionChangeExit(void *);
+static void MC1APP_OutputsDisable(void *);
+static void MC1APP_StopEntry(void *);
+static void MC1APP_FaultEntry(void *);
+static void MC1APP_FaultExit(void *);
+static bool MC1APP_RunCmdGuard(void *);
+static bool MC1APP_StopCmdGuard(void *);
+static bool MC1APP_DirectionCmdGuard(void *);
+static bool MC1APP_HallSeqIdentGuard(void *);
+static bool MC1APP_OffsetGuard(void *);
+static bool MC1APP_MotorStopGuard(void *);
+static bool MC1APP_FaultRetryGuard(void *);
+static bool MC1APP_FaultClearGuard(void *);
+static bool MC1APP_FaultRetryReady(MC1APP_DATA_T *);
 static void MCAPP_MC1ReceivedDataProcess(MC1APP_DATA_T *);
 static void MCAPP_HallSequenceIdentifier(MC1APP_DATA_T *);
+static void MCAPP_CommutationSourceSelect(MC1APP_DATA_T *);
+static void MCAPP_MC1ControlInputsSet(MC1APP_DATA_T *);
+static void MCAPP_MC1DegradedLimitsSet(MC1APP_DATA_T *, bool);
+static bool MCAPP_BusCurrentSamplingPointSet(MCAPP_CONTROL_SCHEME_T *);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+/* The budgets of all the slots must fit in the control loop period */
+#if (SCHEDULER_CONTROL_BUDGET_nSec + SCHEDULER_CURRENT_LIMIT_BUDGET_nSec + \
+                    SCHEDULER_THERMAL_BUDGET_nSec) > SCHEDULER_TICK_nSec
+#error "Scheduler slot budgets exceed the control loop period"
+#endif
+#if (SCHEDULER_CURRENT_LIMIT_PHASE >= \
+                    (CURRENT_LIMIT_UPDATE_mSec*PWMFREQUENCY_HZ/1000)) || \
+    (SCHEDULER_THERMAL_PHASE >= (THERMAL_MODEL_UPDATE_mSec*PWMFREQUENCY_HZ/1000))
+#error "Scheduler slot phase must be less than the slot divider"
+#endif
+
+/* Static task table of the control loop interrupt, the slow slots execute 
+   on different ticks by their phase */
+static const MCAPP_SCHEDULER_SLOT_T mcSchedulerSlot[MC_SCHEDULER_SLOTS] =
+{
+    {MCAPP_MC1ControlTask, 1, 0, 
+        SCHEDULER_BUDGET_COUNTS(SCHEDULER_CONTROL_BUDGET_nSec)},
+    {MCAPP_MC1CurrentLimitTask, CURRENT_LIMIT_UPDATE_COUNTS, 
+        SCHEDULER_CURRENT_LIMIT_PHASE, 
+        SCHEDULER_BUDGET_COUNTS(SCHEDULER_CURRENT_LIMIT_BUDGET_nSec)},
+    {MCAPP_MC1ThermalTask, THERMAL_MODEL_UPDATE_COUNTS, 
+        SCHEDULER_THERMAL_PHASE, 
+        SCHEDULER_BUDGET_COUNTS(SCHEDULER_THERMAL_BUDGET_nSec)},
+};
+
+/* Entry, step and exit actions of the application states, indexed by 
+   MCAPP_STATE_T */
+static const MCAPP_STATE_HANDLERS_T mcStateHandlers[MCAPP_STATE_COUNT] =
+{
+    /* MCAPP_INIT */
+    {MC1APP_InitEntry, NULL, NULL},
+    /* MCAPP_CMD_WAIT */
+    {NULL, NULL, NULL},
+    /* MCAPP_OFFSET */
+    {MC1APP_OffsetEntry, MC1APP_OffsetStep, NULL},
+    /* MCAPP_RUN */
+    {MC1APP_RunEntry, MC1APP_RunStep, NULL},
+    /* MCAPP_DIRECTION_CHANGE */
+    {MC1APP_OutputsDisable, MC1APP_DirectionChangeStep, 
+                                                MC1APP_DirectionChangeExit},
+    /* MCAPP_STOP */
+    {MC1APP_StopEntry, NULL, NULL},
+    /* MCAPP_FAULT */
+    {MC1APP_FaultEntry, MC1APP_OutputsDisable, MC1APP_FaultExit},
+    /* MCAPP_HALLSEQ_IDENT */
+    {NULL, MC1APP_HallSeqIdentStep, NULL},
+};
+
+/* Class of each fault code, indexed by MCAPP_FAULTS_T */
+static const uint8_t mcFaultClass[MCAPP_FAULT_CODE_COUNT] =
+{
+    FAULT_CLASS_FATAL,          /* No fault */
+    FAULT_CLASS_TRANSIENT,      /* MCAPP_DCBUS_OV_OC_FAULT */
+    FAULT_CLASS_RECOVERABLE,    /* MCAPP_CONTROL_FAULT */
+    FAULT_CLASS_RECOVERABLE,    /* MCAPP_HALL_FAILURE */
+    FAULT_CLASS_TRANSIENT,      /* MCAPP_TIMER_ERROR */
+    FAULT_CLASS_FATAL,          /* MCAPP_HALLSEQ_IDENT_FAILURE */
+    FAULT_CLASS_RECOVERABLE,    /* MCAPP_BEMF_FAILURE */
+    FAULT_CLASS_RECOVERABLE,    /* MCAPP_THERMAL_FAULT */
+};
+
+/* Transitions of the application states sorted by the state left, the 
+   first transition with its guard true is taken. Faults are evaluated 
+   before the transitions by MC1APP_FaultCheck. */
+static const MCAPP_STATE_TRANSITION_T mcStateTransitions[] =
+{
+    {MCAPP_INIT, NULL, MCAPP_HALLSEQ_IDENT, MCAPP_CAUSE_COMPLETE},
+    {MCAPP_CMD_WAIT, MC1APP_RunCmdGuard, MCAPP_OFFSET, MCAPP_CAUSE_RUN_CMD},
+    {MCAPP_OFFSET, MC1APP_OffsetGuard, MCAPP_RUN, MCAPP_CAUSE_COMPLETE},
+    {MCAPP_RUN, MC1APP_DirectionCmdGuard, MCAPP_DIRECTION_CHANGE, 
+                                                MCAPP_CAUSE_DIRECTION_CMD},
+    {MCAPP_RUN, MC1APP_StopCmdGuard, MCAPP_STOP, MCAPP_CAUSE_STOP_CMD},
+    {MCAPP_DIRECTION_CHANGE, MC1APP_MotorStopGuard, MCAPP_INIT, 
+                                                    MCAPP_CAUSE_COMPLETE},
+    {MCAPP_STOP, NULL, MCAPP_INIT, MCAPP_CAUSE_COMPLETE},
+    {MCAPP_FAULT, MC1APP_FaultRetryGuard, MCAPP_OFFSET, MCAPP_CAUSE_RETRY},
+    {MCAPP_FAULT, MC1APP_FaultClearGuard, MCAPP_INIT, MCAPP_CAUSE_RETRY},
+    {MCAPP_HALLSEQ_IDENT, MC1APP_HallSeqIdentGuard, MCAPP_CMD_WAIT, 
+                                                    MCAPP_CAUSE_COMPLETE},
+};
 
 // </editor-fold>
 
 /**
-* <B> Function: void MC1APP_StateMachine (MC1APP_DATA_T *)  </B>
+* <B> Function: uint16_t MC1APP_FaultCheck (void *)  </B>
 *
-* @brief Application state machine.
+* @brief Fault check of the application state machine, evaluated before the
+*        transitions every control loop. Hall failure is not a fault while 
+*        BEMF zero crossings drive the commutation. The fault check runs 
+*        before the step of MCAPP_RUN selects the commutation source, so with
+*        BEMF_COMMUTATION_FALLBACK defined Hall failure is also not a fault 
+*        while the zero crossings are locked, the step then takes over.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return Fault code (MCAPP_FAULTS_T), 0 = no fault.
+* 
+* @example
+* <CODE> fault = MC1APP_FaultCheck(&mc); </CODE>
+*
+*/
+static uint16_t MC1APP_FaultCheck(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    MCAPP_MEASURE_T *pMotorInputs = &pMCData->motorInputs;
+    bool hallFault = (pMotorInputs->detectRotorPosition.hallFailure == 1) && 
+                                    (pMotorInputs->detectBemf.commutate == 0);
+    
+#ifdef BEMF_COMMUTATION_FALLBACK
+    /* The step of MCAPP_RUN takes over on the locked zero crossings */
+    if((pMCData->appState == MCAPP_RUN) && 
+                                    (pMotorInputs->detectBemf.valid == 1))
+    {
+        hallFault = 0;
+    }
+#endif
+    if(pMCData->faultRequest != 0)
+    {
+        return pMCData->faultRequest;
+    }
+    if(pMCData->hallSeqIdent.failure == 1)
+    {
+        return MCAPP_HALLSEQ_IDENT_FAILURE;
+    }
+    if(pMCData->controlScheme.faultStatus == 1)
+    {
+        return MCAPP_CONTROL_FAULT;
+    }
+    if(pMotorInputs->detectBemf.failure == 1)
+    {
+        return MCAPP_BEMF_FAILURE;
+    }
+    if(hallFault == 1)
+    {
+        return MCAPP_HALL_FAILURE;
+    }
+    if(pMotorInputs->detectRotorPosition.timerError == 1)
+    {
+        return MCAPP_TIMER_ERROR;
+    }
+    return 0;
+}
+
+/**
+* <B> Function: void MC1APP_InitEntry (void *)  </B>
+*
+* @brief Entry of MCAPP_INIT : stop the motor and initialize the run time 
+*        parameters.
 *
 * @param Pointer to the data structure containing Application parameters.
 * @return none.
 * 
 * @example
-* <CODE> MC1APP_StateMachine(&mc); </CODE>
+* <CODE> MC1APP_InitEntry(&mc); </CODE>
 *
 */
-static void MC1APP_StateMachine(MC1APP_DATA_T *pMCData)
+static void MC1APP_InitEntry(void *pContext)
 {
-    MCAPP_MEASURE_T *pMotorInputs = pMCData->pMotorInputs;
-    MCAPP_CONTROL_SCHEME_T *pControlScheme = pMCData->pControlScheme;
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    MCAPP_MEASURE_T *pMotorInputs = &pMCData->motorInputs;
+    MCAPP_CONTROL_SCHEME_T *pControlScheme = &pMCData->controlScheme;
+    
+    HAL_PWMDisableOutputs(pMCData->pHal);
+
+    /* Stop the motor */
+    pMCData->runCmd = 0;       
+
+    MCAPP_TrapezoidalControlInit(pControlScheme);
+    /* Hall sensors drive the commutation after initialization */
+    MCAPP_MeasureInit(pMotorInputs);      
+    pMCData->runStatus &= ~MCAPP_BEMF_COMMUTATION;
+}
 
-    switch(pMCData->appState)
+/**
+* <B> Function: void MC1APP_HallSeqIdentStep (void *)  </B>
+*
+* @brief Step of MCAPP_HALLSEQ_IDENT : run the Hall sequence identifier till
+*        the sequence is identified.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_HallSeqIdentStep(&mc); </CODE>
+*
+*/
+static void MC1APP_HallSeqIdentStep(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    if(pMCData->hallSeqIdent.status == 0) 
     {
-    case MCAPP_INIT:
+        MCAPP_HallSequenceIdentifier(pMCData);
+    }
+}
 
-        HAL_MC1PWMDisableOutputs();
+/**
+* <B> Function: void MC1APP_OffsetEntry (void *)  </B>
+*
+* @brief Entry of MCAPP_OFFSET : charge the bootstrap capacitors.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_OffsetEntry(&mc); </CODE>
+*
+*/
+static void MC1APP_OffsetEntry(void *pContext)
+{
+    ChargeBootstrapCapacitors();
+}
 
-        /* Stop the motor */
-        pMCData->runCmd = 0;       
-                
-        MCAPP_TrapezoidalControlInit(pControlScheme);
-        MCAPP_MeasureInit(pMotorInputs);      
-        pMCData->appState = MCAPP_HALLSEQ_IDENT;
-        break;
-        
-    case MCAPP_HALLSEQ_IDENT:    
-        
-        /* Hall sequence identifier */
-        if (pMCData->hallSeqIdent.status == 0) 
-        {
-            MCAPP_HallSequenceIdentifier(pMCData);
-            /* Check for failure in pattern identification */
-            if(pMCData->hallSeqIdent.failure == 1)
-            {
-                pMCData->faultStatus = MCAPP_HALLSEQ_IDENT_FAILURE;
-                pMCData->appState = MCAPP_FAULT;
-                break;
-            }
-        }
-        else
-        {
-            pMCData->appState = MCAPP_CMD_WAIT;
-        }
-        break;
-        
-    case MCAPP_CMD_WAIT:
-        
-        if(pMCData->runCmd == 1)
-        {
-            /* Function call to charge Bootstrap capacitors*/
-            ChargeBootstrapCapacitors();
-            pMCData->appState = MCAPP_OFFSET;
-        }
-       break;
-       
-    case MCAPP_OFFSET:
-        
-        /* Measure Initial Offsets */
-        MCAPP_MeasureCurrentOffset(pMotorInputs);
+/**
+* <B> Function: void MC1APP_OffsetStep (void *)  </B>
+*
+* @brief Step of MCAPP_OFFSET : measure the current offsets.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_OffsetStep(&mc); </CODE>
+*
+*/
+static void MC1APP_OffsetStep(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    MCAPP_MeasureCurrentOffset(&pMCData->motorInputs);
+}
 
-        if(MCAPP_MeasureCurrentOffsetStatus(pMotorInputs))
-        {
-            /* Detect Hall initial position */
-            MCAPP_HallSensorValue(&pMotorInputs->detectRotorPosition);
-            HAL_MC1PWMEnableOutputs();
-            HallSensorEnable();
-            pMCData->appState = MCAPP_RUN;
-        }
+/**
+* <B> Function: void MC1APP_RunEntry (void *)  </B>
+*
+* @brief Entry of MCAPP_RUN : detect the initial Hall position and enable the
+*        PWM outputs and the Hall sensors.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_RunEntry(&mc); </CODE>
+*
+*/
+static void MC1APP_RunEntry(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    MCAPP_HallSensorValue(&pMCData->motorInputs.detectRotorPosition);
+    HAL_PWMEnableOutputs(pMCData->pHal);
+    HallSensorEnable();
+}
 
-        break;
-            
-    case MCAPP_RUN:
-        /* Check for change direction command flag */
-        if(pMCData->directionCmdFlag == 1)
-        {
-            /* Disable PWM outputs while motor is slowing down for change direction*/
-            HAL_MC1PWMDisableOutputs();
-            /* Change run direction */
-            pMCData->appState = MCAPP_DIRECTION_CHANGE;
-            break;
-        }
-        
-        /* Compensate motor current offsets */
-        MCAPP_MeasureCurrentCalibrate(pMotorInputs);
-        /* Phase voltages in actual values */
-        MCAPP_MeasureActualPhaseVoltage(pMotorInputs);
-        
-        MCAPP_MeasureSpeed(&pMotorInputs->detectRotorPosition);
- 
-        MCAPP_TrapezoidalControlStateMachine(pControlScheme);
-        
-        /* Check for control scheme faults */
-        if(pControlScheme->faultStatus == 1 ) 
-        {
-            pMCData->faultStatus = MCAPP_CONTROL_FAULT;
-            pMCData->appState = MCAPP_FAULT;
-            break;
-        }
+/**
+* <B> Function: void MC1APP_RunStep (void *)  </B>
+*
+* @brief Step of MCAPP_RUN : measure the motor inputs and execute the 
+*        trapezoidal control.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_RunStep(&mc); </CODE>
+*
+*/
+static void MC1APP_RunStep(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    MCAPP_MEASURE_T *pMotorInputs = &pMCData->motorInputs;
+    MCAPP_CONTROL_SCHEME_T *pControlScheme = &pMCData->controlScheme;
+    
+    /* Compensate motor current offsets */
+    MCAPP_MeasureCurrentCalibrate(pMotorInputs);
+    /* Phase voltages in actual values */
+    MCAPP_MeasureActualPhaseVoltage(pMotorInputs);
+#if CURRENT_FEEDBACK == 1
+    /* Current of the conducting phases in the sector applied while the 
+       currents were sampled */
+    MCAPP_MeasureConductingCurrent(pMotorInputs, 
+            pControlScheme->commutationSector, pControlScheme->sine.active);
+#endif
 
-        if (pMCData->runCmd == 0)
-        {
-            HallSensorDisable();
-            /* Exit loop if motor not run */
-            pMCData->appState = MCAPP_STOP;
-        }
-        
-        break;
+    MCAPP_MeasureSpeed(&pMotorInputs->detectRotorPosition);
 
-    case MCAPP_DIRECTION_CHANGE:
-        
-        /* Check if motor has stopped */
-        if(pMotorInputs->detectRotorPosition.motorStopCounter == 0)
-        {
-            /* Change direction */
-            pMCData->directionCmd = pMCData->directionCmdBuffer;
-            /* Indicate direction change completed*/
-            pMCData->directionCmdFlag = 0;
-            /* Move state machine state to Init */
-            pMCData->appState = MCAPP_INIT;
-        }
-        else
-        {
-            /* Decrement counter till motor stops running */
-            pMotorInputs->detectRotorPosition.motorStopCounter--;
-        }
-        break;
+    /* Time at the cycle-by-cycle current limit and limit events */
+    MCAPP_CurrentLimitMonitor(&pMCData->currentLimit, 
+                                        HAL_MC1CurrentLimitActive());
 
-    case MCAPP_STOP:
-        HAL_MC1PWMDisableOutputs();
-        pMCData->appState = MCAPP_INIT;
-        
-        break;
-        
-    case MCAPP_FAULT:
-        /* Based on the application handle the fault state appropriately, 
-           in this example there is no recovery from fault state */
-        HAL_MC1PWMDisableOutputs();
-        
-        break;
-        
-    default:
-        HAL_MC1PWMDisableOutputs();
-        break;     
+    /* BEMF zero crossing detection on the floating phase */
+    MCAPP_BemfZeroCrossUpdate(&pMotorInputs->detectBemf, 
+                                        HallStateChangeTimerDataRead());
+    MCAPP_CommutationSourceSelect(pMCData);
 
-    } /* end of switch-case */
+    /* Hall degraded operation : reduce the speed and current limits, the 
+       Hall input failure is retained until reset */
+    if(pMotorInputs->detectRotorPosition.degraded.active != 
+                                                    pMCData->degradedLimits)
+    {
+        MCAPP_MC1DegradedLimitsSet(pMCData, 
+                    pMotorInputs->detectRotorPosition.degraded.active);
+    }
+
+    MCAPP_MC1ControlInputsSet(pMCData);
+    MCAPP_TrapezoidalControlStateMachine(pControlScheme);
+
+    /* Sample the bus current in the middle of its pulse in the next PWM 
+       cycle, a pulse too short to settle is not measured */
+    pMotorInputs->measureCurrent.IbusValid = 
+                    MCAPP_BusCurrentSamplingPointSet(pControlScheme);
+}
+
+/**
+* <B> Function: void MCAPP_MC1DegradedLimitsSet (MC1APP_DATA_T *, bool)  </B>
+*
+* @brief Function to set the speed and current limits of Hall degraded 
+*        operation, or the configured limits. The limits are computed from 
+*        the configured values, they are not scaled again when the run 
+*        status changes.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @param 1 = Hall degraded operation limits, 0 = configured limits.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MC1DegradedLimitsSet(&mc, 1); </CODE>
+*
+*/
+static void MCAPP_MC1DegradedLimitsSet(MC1APP_DATA_T *pMCData, bool degraded)
+{
+    MCAPP_MOTOR_T *pMotor = &pMCData->controlScheme.motor;
     
-    /* Fault Handler */
-    if (pMotorInputs->detectRotorPosition.hallFailure == 1 || 
-                            pMotorInputs->detectRotorPosition.timerError == 1)
+    if(degraded == 1)
     {
-        HAL_MC1PWMDisableOutputs();
-        if(pMotorInputs->detectRotorPosition.hallFailure == 1)
-        {
-            pMCData->faultStatus = MCAPP_HALL_FAILURE;
-        }
-        else
-        {
-            pMCData->faultStatus = MCAPP_TIMER_ERROR;
-        }
-        pMCData->appState = MCAPP_FAULT;
-    } 
+        pMotor->MaxSpeed = MAXIMUM_SPEED_RPM * HALL_DEGRADED_LIMIT_FACTOR;
+        pMotor->RatedCurrent = 
+                        NOMINAL_CURRENT_BUS_RMS * HALL_DEGRADED_LIMIT_FACTOR;
+        pMCData->runStatus |= MCAPP_HALL_DEGRADED;
+    }
+    else
+    {
+        pMotor->MaxSpeed = MAXIMUM_SPEED_RPM;
+        pMotor->RatedCurrent = NOMINAL_CURRENT_BUS_RMS;
+        pMCData->runStatus &= ~MCAPP_HALL_DEGRADED;
+    }
+    pMCData->degradedLimits = degraded;
+}
+
+/**
+* <B> Function: void MC1APP_DirectionChangeStep (void *)  </B>
+*
+* @brief Step of MCAPP_DIRECTION_CHANGE : count down till the motor stops.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_DirectionChangeStep(&mc); </CODE>
+*
+*/
+static void MC1APP_DirectionChangeStep(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    if(pMCData->motorInputs.detectRotorPosition.motorStopCounter > 0)
+    {
+        pMCData->motorInputs.detectRotorPosition.motorStopCounter--;
+    }
+}
+
+/**
+* <B> Function: void MC1APP_DirectionChangeExit (void *)  </B>
+*
+* @brief Exit of MCAPP_DIRECTION_CHANGE : change the direction.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_DirectionChangeExit(&mc); </CODE>
+*
+*/
+static void MC1APP_DirectionChangeExit(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    pMCData->directionCmd = pMCData->directionCmdBuffer;
+    /* Indicate direction change completed*/
+    pMCData->directionCmdFlag = 0;
+}
+
+/**
+* <B> Function: void MC1APP_OutputsDisable (void *)  </B>
+*
+* @brief Entry of MCAPP_DIRECTION_CHANGE and step of MCAPP_FAULT : disable 
+*        the PWM outputs.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_OutputsDisable(&mc); </CODE>
+*
+*/
+static void MC1APP_OutputsDisable(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    HAL_PWMDisableOutputs(pMCData->pHal);
+}
+
+/**
+* <B> Function: void MC1APP_StopEntry (void *)  </B>
+*
+* @brief Entry of MCAPP_STOP : disable the Hall sensors and the PWM outputs.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_StopEntry(&mc); </CODE>
+*
+*/
+static void MC1APP_StopEntry(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    HallSensorDisable();
+    HAL_PWMDisableOutputs(pMCData->pHal);
+}
+
+/**
+* <B> Function: void MC1APP_FaultEntry (void *)  </B>
+*
+* @brief Entry of MCAPP_FAULT : disable the PWM outputs, latch the fault
+*        code and schedule the retry of the fault. A fatal fault, or a fault 
+*        retried too often, is not recovered till reset.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_FaultEntry(&mc); </CODE>
+*
+*/
+static void MC1APP_FaultEntry(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    HAL_PWMDisableOutputs(pMCData->pHal);
+    pMCData->faultStatus = pMCData->stateEngine.fault;
+    pMCData->faultRequest = 0;
+    MCAPP_FaultManagerFault(&pMCData->faultManager, pMCData->faultStatus, 
+                                                pMCData->stateEngine.tick);
+}
+
+/**
+* <B> Function: void MC1APP_FaultExit (void *)  </B>
+*
+* @brief Exit of MCAPP_FAULT : the fault flags and the control are reset 
+*        while the Hall sequence and the run command are kept. The limits 
+*        of Hall degraded operation applied and their run status are kept.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MC1APP_FaultExit(&mc); </CODE>
+*
+*/
+static void MC1APP_FaultExit(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    MCAPP_HALL_SENSOR_T *pHallSensor = 
+                                &pMCData->motorInputs.detectRotorPosition;
+    
+    pMCData->faultRequest = 0;
+    pMCData->hallSeqIdent.failure = 0;
+    pHallSensor->hallFailure = 0;
+    pHallSensor->timerError = 0;
+    pMCData->faultStatus = 0;
+    /* Hall sensors drive the commutation after initialization */
+    pMCData->runStatus &= ~MCAPP_BEMF_COMMUTATION;
+    
+    MCAPP_TrapezoidalControlInit(&pMCData->controlScheme);
+    MCAPP_MeasureInit(&pMCData->motorInputs);
+}
+
+/**
+* <B> Function: bool MC1APP_RunCmdGuard (void *)  </B>
+*
+* @brief Guard of the transition on the run command.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return 1 = run command.
+* 
+* @example
+* <CODE> MC1APP_RunCmdGuard(&mc); </CODE>
+*
+*/
+static bool MC1APP_RunCmdGuard(void *pContext)
+{
+    return (((MC1APP_DATA_T *)pContext)->runCmd == 1);
+}
+
+/**
+* <B> Function: bool MC1APP_StopCmdGuard (void *)  </B>
+*
+* @brief Guard of the transition on the stop command.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return 1 = stop command.
+* 
+* @example
+* <CODE> MC1APP_StopCmdGuard(&mc); </CODE>
+*
+*/
+static bool MC1APP_StopCmdGuard(void *pContext)
+{
+    return (((MC1APP_DATA_T *)pContext)->runCmd == 0);
+}
+
+/**
+* <B> Function: bool MC1APP_DirectionCmdGuard (void *)  </B>
+*
+* @brief Guard of the transition on the change direction command.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return 1 = change direction command.
+* 
+* @example
+* <CODE> MC1APP_DirectionCmdGuard(&mc); </CODE>
+*
+*/
+static bool MC1APP_DirectionCmdGuard(void *pContext)
+{
+    return (((MC1APP_DATA_T *)pContext)->directionCmdFlag == 1);
+}
+
+/**
+* <B> Function: bool MC1APP_HallSeqIdentGuard (void *)  </B>
+*
+* @brief Guard of the transition on the Hall sequence identified.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return 1 = Hall sequence identified.
+* 
+* @example
+* <CODE> MC1APP_HallSeqIdentGuard(&mc); </CODE>
+*
+*/
+static bool MC1APP_HallSeqIdentGuard(void *pContext)
+{
+    return (((MC1APP_DATA_T *)pContext)->hallSeqIdent.status == 1);
+}
+
+/**
+* <B> Function: bool MC1APP_OffsetGuard (void *)  </B>
+*
+* @brief Guard of the transition on the current offsets measured.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return 1 = current offsets measured.
+* 
+* @example
+* <CODE> MC1APP_OffsetGuard(&mc); </CODE>
+*
+*/
+static bool MC1APP_OffsetGuard(void *pContext)
+{
+    return (MCAPP_MeasureCurrentOffsetStatus(
+                            &((MC1APP_DATA_T *)pContext)->motorInputs) != 0);
+}
+
+/**
+* <B> Function: bool MC1APP_MotorStopGuard (void *)  </B>
+*
+* @brief Guard of the transition on the motor stopped for change direction.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return 1 = motor stopped.
+* 
+* @example
+* <CODE> MC1APP_MotorStopGuard(&mc); </CODE>
+*
+*/
+static bool MC1APP_MotorStopGuard(void *pContext)
+{
+    return (((MC1APP_DATA_T *)pContext)->motorInputs.
+                                    detectRotorPosition.motorStopCounter == 0);
+}
+
+/**
+* <B> Function: bool MC1APP_FaultRetryGuard (void *)  </B>
+*
+* @brief Guard of the warm restart from fault on the retry due with the run 
+*        command and the Hall sequence identified.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return 1 = restart the motor.
+* 
+* @example
+* <CODE> MC1APP_FaultRetryGuard(&mc); </CODE>
+*
+*/
+static bool MC1APP_FaultRetryGuard(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    return ((pMCData->runCmd == 1) && (pMCData->hallSeqIdent.status == 1) &&
+                                    (MC1APP_FaultRetryReady(pMCData) == 1));
+}
+
+/**
+* <B> Function: bool MC1APP_FaultClearGuard (void *)  </B>
+*
+* @brief Guard of the transition from fault to initialization on the retry 
+*        due without the run command or without the Hall sequence identified,
+*        the sequence is then identified again.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return 1 = clear the fault.
+* 
+* @example
+* <CODE> MC1APP_FaultClearGuard(&mc); </CODE>
+*
+*/
+static bool MC1APP_FaultClearGuard(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    return (((pMCData->runCmd == 0) || (pMCData->hallSeqIdent.status != 1)) &&
+                                    (MC1APP_FaultRetryReady(pMCData) == 1));
+}
+
+/**
+* <B> Function: bool MC1APP_FaultRetryReady (MC1APP_DATA_T *)  </B>
+*
+* @brief Function to check if the retry delay of the fault elapsed and the 
+*        temperature estimate is below the trip level.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return 1 = retry due.
+* 
+* @example
+* <CODE> MC1APP_FaultRetryReady(&mc); </CODE>
+*
+*/
+static bool MC1APP_FaultRetryReady(MC1APP_DATA_T *pMCData)
+{
+    return ((MCAPP_FaultManagerRetryDue(&pMCData->faultManager, 
+                                        pMCData->stateEngine.tick) == 1) && 
+                                    (pMCData->thermalModel.trip == 0));
 }
 
 /**
@@ -253,14 +795,14 @@ static void MCAPP_HallSequenceIdentifier(MC1APP_DATA_T *pMCData)
             /* Setting the ADC sampling point for the identifier */
             SetADCSamplingPoint(0);
             /* Initialize the identifier parameters. */
-            HallSeqIdentifier_Init(&pMCData->hallSeqIdent,pMCData->pControlScheme->pwmPeriod);
+            HallSeqIdentifier_Init(&pMCData->hallSeqIdent,pMCData->controlScheme.pwmPeriod);
             pMCData->hallSeqIdent.state = MCAPP_HALLSEQ_OFFSET;
             break;
         case MCAPP_HALLSEQ_OFFSET:
             /* Measure Initial Offsets */
-            MCAPP_MeasureCurrentOffset(pMCData->pMotorInputs);
+            MCAPP_MeasureCurrentOffset(&pMCData->motorInputs);
 
-            if(MCAPP_MeasureCurrentOffsetStatus(pMCData->pMotorInputs))
+            if(MCAPP_MeasureCurrentOffsetStatus(&pMCData->motorInputs))
             {
                ChargeBootstrapCapacitors();
                pMCData->hallSeqIdent.state = MCAPP_HALLSEQ_EXECUTE;
@@ -271,11 +813,11 @@ static void MCAPP_HallSequenceIdentifier(MC1APP_DATA_T *pMCData)
             if (pMCData->hallSeqIdent.executionFlag == 0) 
             {
                 /* Compensate motor current offsets */
-                MCAPP_MeasureCurrentCalibrate(pMCData->pMotorInputs);
+                MCAPP_MeasureCurrentCalibrate(&pMCData->motorInputs);
 
                 /* Function to execute hall sequence identifier */
                 HallSeqIdentifier_Execute(&pMCData->hallSeqIdent, 
-                                   pMCData->pMotorInputs->filterBusCurrent); 
+                                   pMCData->motorInputs.filterBusCurrent); 
             }
             else 
             { 
@@ -284,10 +826,51 @@ static void MCAPP_HallSequenceIdentifier(MC1APP_DATA_T *pMCData)
             break;
         case MCAPP_HALLSEQ_COMPLETE:
             
-            /* Load the inverter switching array */
-            MCAPP_LoadInverterSwitchingArray(pMCData->hallSeqIdent.ovrDataOutPWM3, 
+            /* Load the inverter switching array of the selected PWM pattern */
+            if(pMCData->controlScheme.pwmPattern == PWM_PATTERN_COMPLEMENTARY)
+            {
+                MCAPP_LoadInverterSwitchingArray(&pMCData->controlScheme,
+                        pMCData->hallSeqIdent.ovrCompDataOutPWM3, 
+                        pMCData->hallSeqIdent.ovrCompDataOutPWM2,
+                        pMCData->hallSeqIdent.ovrCompDataOutPWM1);
+            }
+            else
+            {
+                MCAPP_LoadInverterSwitchingArray(&pMCData->controlScheme,
+                        pMCData->hallSeqIdent.ovrDataOutPWM3, 
+                        pMCData->hallSeqIdent.ovrDataOutPWM2,
+                        pMCData->hallSeqIdent.ovrDataOutPWM1);
+            }
+            /* Load the Hall transition validator from the identified 
+               sequence, an inconsistent sequence is an identification failure */
+            if(MCAPP_HallValidatorLoad(
+                    &pMCData->motorInputs.detectRotorPosition.validator,
+                    pMCData->hallSeqIdent.sectorSequence) == false)
+            {
+                pMCData->hallSeqIdent.failure = 1;
+            }
+            /* Load the commutation order and switching arrays used by the 
+               BEMF zero crossing commutation, an inconsistent sequence is 
+               an identification failure */
+            if(MCAPP_BemfZeroCrossLoad(&pMCData->motorInputs.detectBemf,
+                    pMCData->hallSeqIdent.sectorSequence,
+                    pMCData->hallSeqIdent.ovrDataOutPWM3, 
+                    pMCData->hallSeqIdent.ovrDataOutPWM2,
+                    pMCData->hallSeqIdent.ovrDataOutPWM1) == false)
+            {
+                pMCData->hallSeqIdent.failure = 1;
+            }
+            /* Load the phase connected to DC- in each sector used for the 
+               conducting phase current */
+            MCAPP_MeasureConductingPhaseLoad(&pMCData->motorInputs,
+                    pMCData->hallSeqIdent.ovrDataOutPWM3, 
                     pMCData->hallSeqIdent.ovrDataOutPWM2,
                     pMCData->hallSeqIdent.ovrDataOutPWM1);
+            /* Load the electrical angle of the Hall sectors used for 
+               sinusoidal commutation */
+            MCAPP_HallAngleLoad(
+                    &pMCData->motorInputs.detectRotorPosition.rotorAngle,
+                    pMCData->hallSeqIdent.sectorSequence);
             /* Setting the ADC sampling point for the control */
             SetADCSamplingPoint(1);
 
@@ -301,16 +884,150 @@ static void MCAPP_HallSequenceIdentifier(MC1APP_DATA_T *pMCData)
     }
 }
 
+/**
+* <B> Function: void MCAPP_CommutationSourceSelect (MC1APP_DATA_T *)  </B>
+*
+* @brief Function to select the rotor position feedback for commutation.
+*        BEMF zero crossings take over from the Hall sensors on command or, 
+*        if BEMF_COMMUTATION_FALLBACK is defined, on Hall failure. The take 
+*        over is done only when the zero crossings are locked to the rotor, 
+*        the zero crossing detection is synchronized to the Hall commutation 
+*        till then.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_CommutationSourceSelect(&mc); </CODE>
+*
+*/
+static void MCAPP_CommutationSourceSelect(MC1APP_DATA_T *pMCData)
+{
+    MCAPP_MEASURE_T *pMotorInputs = &pMCData->motorInputs;
+    MCAPP_BEMF_T *pBemf = &pMotorInputs->detectBemf;
+    bool bemfRequest = (pMCData->bemfCommutationCmd == 1);
+    
+#ifdef BEMF_COMMUTATION_FALLBACK
+    if(pMotorInputs->detectRotorPosition.hallFailure == 1)
+    {
+        bemfRequest = 1;
+    }
+#endif
+    
+    if((pBemf->commutate == 0) && (bemfRequest == 1) && (pBemf->valid == 1))
+    {
+        pBemf->commutate = 1;
+        if(pMotorInputs->detectRotorPosition.hallFailure == 1)
+        {
+            pMCData->runStatus |= MCAPP_BEMF_COMMUTATION;
+        }
+    }
+    else if((pBemf->commutate == 1) && (bemfRequest == 0))
+    {
+        pBemf->commutate = 0;
+        pMCData->runStatus &= ~MCAPP_BEMF_COMMUTATION;
+    }
+}
+
+/**
+* <B> Function: void MCAPP_MC1ControlInputsSet (MC1APP_DATA_T *)  </B>
+*
+* @brief Function to write the inputs of the control loop into the hot 
+*        fields of the control scheme, from the commutation source selected 
+*        by MCAPP_CommutationSourceSelect and the bus current selected by 
+*        CURRENT_FEEDBACK and IBUS_OVERSAMPLING. The control loop reads them 
+*        without pointer indirection.
+*
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MC1ControlInputsSet(&mc); </CODE>
+*
+*/
+static void MCAPP_MC1ControlInputsSet(MC1APP_DATA_T *pMCData)
+{
+    MCAPP_MEASURE_T *pMotorInputs = &pMCData->motorInputs;
+    MCAPP_CONTROL_SCHEME_T *pControlScheme = &pMCData->controlScheme;
+    
+    if(pMotorInputs->detectBemf.commutate == 1)
+    {
+        pControlScheme->sector = pMotorInputs->detectBemf.sector;
+        pControlScheme->measuredSpeed = pMotorInputs->detectBemf.speed;
+        pControlScheme->speedSample = pMotorInputs->detectBemf.newSample;
+    }
+    else
+    {
+        pControlScheme->sector = 
+                            pMotorInputs->detectRotorPosition.advance.sector;
+        pControlScheme->measuredSpeed = 
+                    pMotorInputs->detectRotorPosition.calculateSpeed.speed;
+        pControlScheme->speedSample = 
+                    pMotorInputs->detectRotorPosition.calculateSpeed.newSample;
+    }
+    pControlScheme->directionCmd = pMCData->directionCmd;
+    pControlScheme->busVoltage = pMotorInputs->measureVdc.value;
+#if CURRENT_FEEDBACK == 1
+    pControlScheme->avgCurrent = pMotorInputs->conductingCurrent.current;
+#elif IBUS_OVERSAMPLING > 0
+    pControlScheme->avgCurrent = pMotorInputs->measureCurrent.IbusAvg_actual;
+#else
+    pControlScheme->avgCurrent = pMotorInputs->filterBusCurrent;
+#endif
+}
+
+/**
+* <B> Function: bool MCAPP_BusCurrentSamplingPointSet (MCAPP_CONTROL_SCHEME_T *)  </B>
+*
+* @brief Function to set the ADC sampling point of the bus current from the 
+*        duty cycles loaded in this control loop. In six-step commutation 
+*        one phase is switched with the duty cycle, in sinusoidal commutation
+*        the bus current pulse is set by the highest and the middle duty.
+*
+* @param Pointer to the data structure containing control parameters.
+* @return Bus current pulse long enough to be sampled.
+* 
+* @example
+* <CODE> valid = MCAPP_BusCurrentSamplingPointSet(pControlScheme); </CODE>
+*
+*/
+static bool MCAPP_BusCurrentSamplingPointSet(
+                                    MCAPP_CONTROL_SCHEME_T *pControlScheme)
+{
+    uint32_t *pDuty = pControlScheme->sine.duty;
+    uint32_t dutyHigh, dutyMiddle;
+    
+    if(pControlScheme->sine.active == 0)
+    {
+        return HAL_ADCSamplingPointUpdate(pControlScheme->pwmDuty, 0);
+    }
+    
+    dutyHigh = pDuty[0];
+    dutyMiddle = pDuty[1];
+    if(dutyMiddle > dutyHigh)
+    {
+        dutyMiddle = pDuty[0];
+        dutyHigh = pDuty[1];
+    }
+    if(pDuty[2] > dutyHigh)
+    {
+        dutyMiddle = dutyHigh;
+        dutyHigh = pDuty[2];
+    }
+    else if(pDuty[2] > dutyMiddle)
+    {
+        dutyMiddle = pDuty[2];
+    }
+    return HAL_ADCSamplingPointUpdate(dutyHigh, dutyMiddle);
+}
+
 /**
 * <B> Function: MC1_ADC_INTERRUPT()  </B>
 *
 * @brief ADC interrupt vector ,and it performs following actions:
-*        (1) Increments DiagnosticsStepIsr for X2C Scope 
-*        (2) Reads motor 1 bus current and phase voltage
-*            feedbacks from ADC data buffers.
-*        (3) Executes Trapezoidal Control based on the current and speed feedbacks.
-*        (4) Loads duty cycle  to the registers of PWM Generators 
-*             controlling motor 1.
+*        (1) Increments DiagnosticsStepIsr for X2C Scope and updates the 
+*            measured signals of motor 1 requested by X2C Scope
+*        (2) Ticks the task scheduler of each motor control instance
 * 
 * @param none.
 * @return none.
@@ -321,26 +1038,150 @@ static void MCAPP_HallSequenceIdentifier(MC1APP_DATA_T *pMCData)
 void __attribute__((__interrupt__,no_auto_psv)) MC1_ADC_INTERRUPT()
 {
     int16_t __attribute__((__unused__)) adcBuffer;
+    uint16_t instance;
     
     #ifdef ENABLE_DIAGNOSTICS
         DiagnosticsStepIsr();
+        MCAPP_MeasureSubscribe(&pMC1Data->motorInputs, 
+                MEASURE_CONSUMER_DIAGNOSTICS, DiagnosticsMeasureSignalsGet());
     #endif
     
-    HAL_MC1MotorInputsRead(pMC1Data->pMotorInputs);
-    
-    MC1APP_StateMachine(pMC1Data);
-    
-    HAL_PWM_DutyCycleRegister_Set(pMC1Data->pControlScheme->pwmDuty);
+    for(instance = 0; instance < MC_INSTANCE_COUNT; instance++)
+    {
+        MCAPP_SchedulerTick(&mcScheduler[instance]);
+    }
     
     adcBuffer = MC1_ClearADCIF_ReadADCBUF();
 	MC1_ClearADCIF();
 }
 
+/**
+* <B> Function: void MCAPP_MC1ControlTask (void *)  </B>
+*
+* @brief Task executed every control loop :
+*        (1) Reads bus current and phase voltage feedbacks from the ADC data 
+*            buffers of the instance.
+*        (2) Processes the Hall edge events queued by the Hall sensor interrupt.
+*        (3) Executes Trapezoidal Control based on the current and speed feedbacks.
+*        (4) Samples the current of the thermal model and the input power.
+*        (5) Loads duty cycle  to the registers of PWM Generators 
+*             of the instance, individual duty cycles in sinusoidal 
+*             commutation. The six-step duty is loaded on change while 
+*             the motor runs.
+* 
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MC1ControlTask(&mcInstance[0]); </CODE>
+*
+*/
+static void MCAPP_MC1ControlTask(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    HAL_MotorInputsRead(pMCData->pHal, &pMCData->motorInputs);
+
+    MCAPP_HallSensorEventsProcess(&pMCData->motorInputs.detectRotorPosition);
+
+    MCAPP_StateEngineStep(&pMCData->stateEngine);
+    
+    /* The motor cools down while it is not running */
+    if(pMCData->appState == MCAPP_RUN)
+    {
+        MCAPP_ThermalModelSample(&pMCData->thermalModel, 
+                                    pMCData->controlScheme.avgCurrent);
+        MCAPP_PowerMeterSample(&pMCData->powerMeter);
+    }
+    else
+    {
+        MCAPP_ThermalModelSample(&pMCData->thermalModel, 0.0f);
+    }
+
+    if(pMCData->controlScheme.sine.active == 1)
+    {
+        HAL_PWM_DutyCycleRegisters_Set(pMCData->pHal, 
+                                pMCData->controlScheme.sine.duty[0],
+                                pMCData->controlScheme.sine.duty[1],
+                                pMCData->controlScheme.sine.duty[2]);
+    }
+    else if(pMCData->appState != MCAPP_RUN)
+    {
+        /* The duty cycle registers are shared with the Hall sequence 
+           identifier and the output enable and disable */
+        HAL_PWM_DutyCycleRegister_Set(pMCData->pHal, 
+                                pMCData->controlScheme.pwmDuty);
+        pMCData->controlScheme.appliedDuty = PWM_DUTY_NONE;
+    }
+    else if(pMCData->controlScheme.pwmDuty != 
+                                    pMCData->controlScheme.appliedDuty)
+    {
+        /* Six-step duty written on change, its write requests the update 
+           of the PWM Generators */
+        HAL_PWM_DutyCycleRegister_Set(pMCData->pHal, 
+                                pMCData->controlScheme.pwmDuty);
+        pMCData->controlScheme.appliedDuty = pMCData->controlScheme.pwmDuty;
+    }
+}
+
+/**
+* <B> Function: void MCAPP_MC1CurrentLimitTask (void *)  </B>
+*
+* @brief Task executed every CURRENT_LIMIT_UPDATE_mSec to update the 
+*        cycle-by-cycle current limit threshold while the motor runs.
+* 
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MC1CurrentLimitTask(&mcInstance[0]); </CODE>
+*
+*/
+static void MCAPP_MC1CurrentLimitTask(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    if(pMCData->appState != MCAPP_RUN)
+    {
+        return;
+    }
+    if(MCAPP_CurrentLimitUpdate(&pMCData->currentLimit))
+    {
+        HAL_MC1CurrentLimitReferenceSet(pMCData->currentLimit.dacValue);
+    }
+}
+
+/**
+* <B> Function: void MCAPP_MC1ThermalTask (void *)  </B>
+*
+* @brief Task executed every THERMAL_MODEL_UPDATE_mSec to update the winding 
+*        and inverter temperature estimates, the motor is stopped with a 
+*        thermal fault above the trip level.
+* 
+* @param Pointer to the data structure containing Application parameters.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MC1ThermalTask(&mcInstance[0]); </CODE>
+*
+*/
+static void MCAPP_MC1ThermalTask(void *pContext)
+{
+    MC1APP_DATA_T *pMCData = (MC1APP_DATA_T *)pContext;
+    
+    if((MCAPP_ThermalModelUpdate(&pMCData->thermalModel) == 1) && 
+                                        (pMCData->appState != MCAPP_FAULT))
+    {
+        HAL_PWMDisableOutputs(pMCData->pHal);
+        pMCData->faultRequest = MCAPP_THERMAL_FAULT;
+    }
+}
+
 /**
 * <B> Function: MC1_HallSensor_Interrupt()     </B>
 *
-* @brief Function to service Hall signal transition and 
-* read the SCCP timer value to measure speed. 
+* @brief Function to service Hall signal transition, 
+* read the SCCP timer value and queue the Hall edge event. 
 *        
 * @param none.
 * @return none.
@@ -350,14 +1191,15 @@ void __attribute__((__interrupt__,no_auto_psv)) MC1_ADC_INTERRUPT()
 */
 void __attribute__((__interrupt__,no_auto_psv)) MC1_HallSensor_Interrupt()
 {
-    HallSensorHandler(&pMC1Data->pMotorInputs->detectRotorPosition);
+    HallSensorHandler(&pMC1Data->motorInputs.detectRotorPosition);
     MC1_HallSensor_Interrupt_FlagClear();  
 }
 
 /**
 * <B> Function: _PWMInterrupt()     </B>
 *
-* @brief Function to handle PWM Fault Interrupt from Fault PCI
+* @brief Function to handle PWM Fault Interrupt from Fault PCI, the fault 
+*        input is shared by all the motor control instances
 *        
 * @param none.
 * @return none.
@@ -367,18 +1209,23 @@ void __attribute__((__interrupt__,no_auto_psv)) MC1_HallSensor_Interrupt()
 */
 void __attribute__((__interrupt__,no_auto_psv)) _PWMInterrupt()
 {
+    uint16_t instance;
+    
     HAL_MC1ClearPWMPCIFault();
-    mc1.appState = MCAPP_FAULT;
-    mc1.faultStatus = MCAPP_DCBUS_OV_OC_FAULT;
+    for(instance = 0; instance < MC_INSTANCE_COUNT; instance++)
+    {
+        mcInstance[instance].faultRequest = MCAPP_DCBUS_OV_OC_FAULT;
+    }
     ClearPWMIF(); 
 }
 
 /**
 * <B> Function: void MCAPP_MC1ServiceInit (void)  </B>
 *
-* @brief Function to initialize the MC1 parameters
+* @brief Function to initialize the parameters of the motor control instances
+*        and bind each instance to its peripherals
 *
-* @param Pointer to the data structure containing Application parameters.
+* @param none.
 * @return none.
 * 
 * @example
@@ -387,12 +1234,34 @@ void __attribute__((__interrupt__,no_auto_psv)) _PWMInterrupt()
 */
 void MCAPP_MC1ServiceInit(void)
 {
-    MCAPP_MC1ParamsInit(pMC1Data);
+    uint16_t instance;
+    
+    for(instance = 0; instance < MC_INSTANCE_COUNT; instance++)
+    {
+        MCAPP_MC1ParamsInit(&mcInstance[instance], mcInstanceHal[instance]);
+        MCAPP_SchedulerInit(&mcScheduler[instance], mcSchedulerSlot, 
+                mcSchedulerStatus[instance], MC_SCHEDULER_SLOTS, 
+                SCCP1_TimerDataRead, &mcInstance[instance]);
+        MCAPP_StateEngineInit(&mcInstance[instance].stateEngine, 
+                mcStateHandlers, MCAPP_STATE_COUNT, mcStateTransitions, 
+                sizeof(mcStateTransitions)/sizeof(mcStateTransitions[0]),
+                &mcInstance[instance].appState, &mcInstance[instance]);
+        MCAPP_StateEngineFaultSet(&mcInstance[instance].stateEngine, 
+                        MC1APP_FaultCheck, MCAPP_FAULT, MCAPP_CAUSE_FAULT);
+        MCAPP_FaultManagerInit(&mcInstance[instance].faultManager, 
+                mcFaultClass, MCAPP_FAULT_CODE_COUNT, FAULT_RETRY_MAX, 
+                FAULT_RETRY_DELAY_COUNTS, FAULT_RETRY_DELAY_MAX_COUNTS, 
+                FAULT_RETRY_WINDOW_COUNTS);
+        MCAPP_StateEngineStart(&mcInstance[instance].stateEngine, MCAPP_INIT);
+    }
 
     MC1_ClearADCIF();
     MC1_EnableADCInterrupt();
     
-    HAL_MC1PWMDisableOutputs();
+    for(instance = 0; instance < MC_INSTANCE_COUNT; instance++)
+    {
+        HAL_PWMDisableOutputs(mcInstance[instance].pHal);
+    }
 }
 
 /**
@@ -415,6 +1284,196 @@ void MCAPP_MC1InputBufferSet(uint16_t runCmd, uint16_t directionCmd )
     MCAPP_MC1ReceivedDataProcess(pMC1Data);
 }
 
+/**
+* <B> Function: bool MCAPP_MC1SpeedProfileSet (float, uint16_t)  </B>
+*
+* @brief Function to command motor 1 to the target speed in the given time,
+*        the potentiometer speed command is ignored till the target speed is
+*        reached.
+*
+* @param Target speed (unit : RPM) and time to reach it (unit : milli seconds)
+* @return 1 = the target speed is reached in time, 0 = the acceleration or 
+*         jerk limit extends the profile.
+* 
+* @example
+* <CODE> MCAPP_MC1SpeedProfileSet(1000.0f, 500); </CODE>
+*
+*/
+bool MCAPP_MC1SpeedProfileSet(float speed, uint16_t time)
+{
+    bool inTime;
+    
+    MC1_DisableADCInterrupt();
+    inTime = MCAPP_SpeedTrajectoryProfileSet(
+                        &pMC1Data->controlScheme.speedTrajectory, speed, time);
+    MC1_EnableADCInterrupt();
+    
+    return inTime;
+}
+
+/**
+* <B> Function: void MCAPP_MC1PositionMoveSet (int32_t)  </B>
+*
+* @brief Function to command motor 1 to move to the target position in 
+*        position control.
+*
+* @param Target position in Hall counts, 6 x POLE_PAIRS per revolution.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MC1PositionMoveSet(position + 30); </CODE>
+*
+*/
+void MCAPP_MC1PositionMoveSet(int32_t target)
+{
+    MC1_DisableADCInterrupt();
+    MCAPP_PositionMoveSet(&pMC1Data->controlScheme.position, target);
+    MC1_EnableADCInterrupt();
+}
+
+/**
+* <B> Function: int32_t MCAPP_MC1PositionGet (void)  </B>
+*
+* @brief Function to read the Hall odometer of motor 1.
+*
+* @param none.
+* @return Rotor position in Hall counts.
+* 
+* @example
+* <CODE> position = MCAPP_MC1PositionGet(); </CODE>
+*
+*/
+int32_t MCAPP_MC1PositionGet(void)
+{
+    int32_t position;
+    
+    MC1_DisableADCInterrupt();
+    position = pMC1Data->motorInputs.detectRotorPosition.position;
+    MC1_EnableADCInterrupt();
+    
+    return position;
+}
+
+/**
+* <B> Function: bool MCAPP_MC1PositionMoveComplete (void)  </B>
+*
+* @brief Function to read the move status of motor 1.
+*
+* @param none.
+* @return 1 = the rotor is within the in-position window of the target.
+* 
+* @example
+* <CODE> MCAPP_MC1PositionMoveComplete(); </CODE>
+*
+*/
+bool MCAPP_MC1PositionMoveComplete(void)
+{
+    return MCAPP_PositionMoveComplete(&pMC1Data->controlScheme.position);
+}
+
+/**
+* <B> Function: void MCAPP_MC1ServiceStepMain (void)  </B>
+*
+* @brief Function executed in the main loop for the slow tasks of the motor
+*        control instances : the aggregation of the power meter.
+*
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MC1ServiceStepMain(); </CODE>
+*
+*/
+void MCAPP_MC1ServiceStepMain(void)
+{
+    uint16_t instance;
+    
+    for(instance = 0; instance < MC_INSTANCE_COUNT; instance++)
+    {
+        MCAPP_PowerMeterAggregate(&mcInstance[instance].powerMeter, 
+                            (mcInstance[instance].appState == MCAPP_RUN));
+    }
+}
+
+/**
+* <B> Function: const MCAPP_POWER_METER_T *MCAPP_MC1PowerMeterGet (void) 
+* </B>
+*
+* @brief Function to read the power meter of motor 1 : the input power, the 
+*        energy counters, the peak power of the run and the efficiency 
+*        estimate. The counters are also readable from X2C Scope over UART as
+*        members of mcInstance.
+*
+* @param none.
+* @return Pointer to the power meter of motor 1.
+* 
+* @example
+* <CODE> energy = MCAPP_MC1PowerMeterGet()->energyRun; </CODE>
+*
+*/
+const MCAPP_POWER_METER_T *MCAPP_MC1PowerMeterGet(void)
+{
+    return &pMC1Data->powerMeter;
+}
+
+/**
+* <B> Function: const MCAPP_THERMAL_MODEL_T *MCAPP_MC1ThermalModelGet (void) 
+* </B>
+*
+* @brief Function to read the thermal model telemetry of motor 1 : the 
+*        winding and inverter temperature estimates and the remaining peak 
+*        torque boost.
+*
+* @param none.
+* @return Pointer to the thermal model of motor 1.
+* 
+* @example
+* <CODE> boostTime = MCAPP_MC1ThermalModelGet()->boostTime; </CODE>
+*
+*/
+const MCAPP_THERMAL_MODEL_T *MCAPP_MC1ThermalModelGet(void)
+{
+    return &pMC1Data->thermalModel;
+}
+
+/**
+* <B> Function: const MCAPP_LOAD_OBSERVER_T *MCAPP_MC1LoadObserverGet (void) 
+* </B>
+*
+* @brief Function to read the load torque observer telemetry of motor 1 : 
+*        the estimated load torque and the duty cycle feed forward.
+*
+* @param none.
+* @return Pointer to the load torque observer of motor 1.
+* 
+* @example
+* <CODE> loadTorque = MCAPP_MC1LoadObserverGet()->torque; </CODE>
+*
+*/
+const MCAPP_LOAD_OBSERVER_T *MCAPP_MC1LoadObserverGet(void)
+{
+    return &pMC1Data->controlScheme.loadObserver;
+}
+
+/**
+* <B> Function: const MCAPP_FAULT_MANAGER_T *MCAPP_MC1FaultManagerGet (void) 
+* </B>
+*
+* @brief Function to read the fault manager telemetry of motor 1 : the last
+*        fault and its class, the retry counters and the latched fault.
+*
+* @param none.
+* @return Pointer to the fault manager of motor 1.
+* 
+* @example
+* <CODE> retries = MCAPP_MC1FaultManagerGet()->retryTotal; </CODE>
+*
+*/
+const MCAPP_FAULT_MANAGER_T *MCAPP_MC1FaultManagerGet(void)
+{
+    return &pMC1Data->faultManager;
+}
+
 /**
 * <B> Function: void MCAPP_MC1ReceivedDataProcess (MC1APP_DATA_T *)  </B>
 *
@@ -429,11 +1488,18 @@ void MCAPP_MC1InputBufferSet(uint16_t runCmd, uint16_t directionCmd )
 */
 static void MCAPP_MC1ReceivedDataProcess(MC1APP_DATA_T *pMCData)
 {
-    MCAPP_CONTROL_SCHEME_T *pControlScheme = pMCData->pControlScheme;
-    MCAPP_MEASURE_T *pMotorInputs = pMCData->pMotorInputs;
+    MCAPP_CONTROL_SCHEME_T *pControlScheme = &pMCData->controlScheme;
+    MCAPP_MEASURE_T *pMotorInputs = &pMCData->motorInputs;
     
     /* Update the run command with run command buffer value */
     pMCData->runCmd = pMCData->runCmdBuffer;
+    
+    /* In position control the direction of the move replaces the direction
+       command */
+    if(pControlScheme->ctrlParam.controlLoop == POSITION_CONTROL)
+    {
+        pMCData->directionCmdBuffer = pControlScheme->position.direction;
+    }
         
     /* If there is a change direction command */
     if( pMCData->directionCmd != pMCData->directionCmdBuffer)
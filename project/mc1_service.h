@@ -48,12 +48,37 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "thermal_model_types.h"
+#include "power_meter_types.h"
+#include "load_observer_types.h"
+#include "fault_manager_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Number of motor control instances executed in the ADC interrupt, each 
+   instance is bound to its peripherals in the table of mc1_service.c */
+#define MC_INSTANCE_COUNT   1
+/* Number of slots of the task table executed in the ADC interrupt for each
+   instance */
+#define MC_SCHEDULER_SLOTS  3
+
 // </editor-fold>
     
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
 
 void MCAPP_MC1ServiceInit(void);
+void MCAPP_MC1ServiceStepMain(void);
 void MCAPP_MC1InputBufferSet(uint16_t, uint16_t);
+bool MCAPP_MC1SpeedProfileSet(float, uint16_t);
+void MCAPP_MC1PositionMoveSet(int32_t);
+int32_t MCAPP_MC1PositionGet(void);
+bool MCAPP_MC1PositionMoveComplete(void);
+const MCAPP_THERMAL_MODEL_T *MCAPP_MC1ThermalModelGet(void);
+const MCAPP_POWER_METER_T *MCAPP_MC1PowerMeterGet(void);
+const MCAPP_LOAD_OBSERVER_T *MCAPP_MC1LoadObserverGet(void);
+const MCAPP_FAULT_MANAGER_T *MCAPP_MC1FaultManagerGet(void);
 
 // </editor-fold>
 
@@ -58,14 +58,53 @@ extern "C" {
 /*Control Loop Selection : 
                         0 = Open-loop duty control
                         1 = Closed-loop speed control using a PI controller
-                        2 = Closed-loop current control using a PI controller */
+                        2 = Closed-loop current control using a PI controller
+                        3 = Closed-loop Hall count position control cascaded
+                            onto the speed PI controller */
 #define CLOSED_LOOP 1
+
+/*Current Feedback Selection for the current control : 
+                        0 = Bus current shunt
+                        1 = Phase current shunt of the phase connected to DC- 
+                            in the commutation sector, the bus current is used 
+                            on phase current saturation and in sinusoidal 
+                            commutation */
+#define CURRENT_FEEDBACK 0
+
+/*Commutation Mode Selection : 
+                        0 = Six-step commutation
+                        1 = Sinusoidal commutation above the entry speed
+                        2 = Space vector commutation above the entry speed
+  Six-step commutation is used below the exit speed and without valid rotor 
+  angle (Hall failure, two sensor operation) */
+#define COMMUTATION_MODE 0
+
+/*Six-step PWM Pattern Selection : 
+                        0 = Independent, the freewheeling current flows through 
+                            the body diodes during the PWM off time
+                        1 = Complementary with dead time, the complementary 
+                            switch conducts the freewheeling current */
+#define PWM_PATTERN 0
+
+/*Bus Current Oversampling Selection : 
+                        0 = One bus current sample per PWM period in the middle 
+                            of the pulse, low pass filtered for the current loop
+                        1, 2, 3 = 2, 4, 8 samples evenly spaced over the PWM 
+                            period are accumulated by the ADC, the current loop 
+                            regulates their average (DC bus current) without 
+                            filter lag */
+#define IBUS_OVERSAMPLING 0
     
 /* Define INTERNAL_OPAMP_CONFIG to use internal op-amp outputs(default), 
  * Undefine INTERNAL_OPAMP_CONFIG to use external op-amp outputs from the 
    development board;Ensure the jumper resistors are modified on DIM  */
 #define INTERNAL_OPAMP_CONFIG
 
+/* Define BEMF_COMMUTATION_FALLBACK to continue running on BEMF zero crossing
+   commutation on Hall sensor failure (once the zero crossings are locked),
+   Undefine BEMF_COMMUTATION_FALLBACK to stop the motor on Hall failure */
+#define BEMF_COMMUTATION_FALLBACK
+
 /*Motor Selection : 1 = Hurst DMA0204024B101(AC300022: Hurst300 or Long Hurst)
                     2 = Hurst DMB0224C10002(AC300020: Hurst075 or Short Hurst)
                     3 = ACT 24V 3-Phase Brushless DC Motor - ACT 57BLF02  
@@ -97,6 +136,10 @@ extern "C" {
    Peak Current  = Vref / (op-amp Gain * Rshunt) 
    where op-amp Gain = 24.95, Vref = 1.65V and Rshunt = 0.003ohm */
 #define MC1_PEAK_CURRENT                22.0f     
+/* Continuous current rating of the inverter (unit : amps) */
+#define INVERTER_CONTINUOUS_CURRENT     10.0f
+/* Thermal time constant of the inverter switches (unit : seconds) */
+#define INVERTER_THERMAL_TIME_CONSTANT_SEC  20.0f
 /* Nominal DC Bus Voltage required by the motor (unit : volts)*/ 
 #define DC_LINK_VOLTAGE                 24.0f 
 
@@ -105,6 +148,93 @@ extern "C" {
 
 /* Sampling time for the control loop */
 #define CRTL_LOOP_RATE    4
+
+/*Speed Loop Execution Selection, speed control only : 
+                        0 = Fixed rate, every CRTL_LOOP_RATE + 2 control loops
+                        1 = Event triggered, on every new speed measurement 
+                            from a Hall (or BEMF) period, with the integral 
+                            gain scaled by the time elapsed since the last 
+                            execution. Without new measurement, as on stall,
+                            the speed loop is executed after 
+                            SPEED_LOOP_TIMEOUT_mSec */
+#define SPEED_LOOP_MODE 0
+#define SPEED_LOOP_TIMEOUT_mSec         20
+
+/* Position control : move speed (unit : RPM), move acceleration 
+   (unit : RPM/s), proportional gain (Hall counts/s per count of position 
+   error), in-position window (unit : Hall counts) and settle time before a 
+   rotor stopped outside the window is moved again (unit : milli seconds) */
+#define POSITION_MOVE_SPEED_RPM         500.0f
+#define POSITION_MOVE_ACCEL_RPM_S       1000.0f
+#define POSITION_KP                     10.0f
+#define POSITION_WINDOW_COUNTS          1
+#define POSITION_SETTLE_mSec            200
+
+/* Dynamic current limit : the cycle-by-cycle current limit is 
+   CURRENT_LIMIT_START_FACTOR x NOMINAL_CURRENT_BUS_RMS at standstill and 
+   folds back to NOMINAL_CURRENT_BUS_RMS at CURRENT_LIMIT_FOLDBACK_FACTOR x 
+   MAXIMUM_SPEED_RPM, it never exceeds OC_FAULT_LIMIT_DCBUS. The limit is 
+   updated every CURRENT_LIMIT_UPDATE_mSec and changes by 
+   CURRENT_LIMIT_SLEW_AMPS_S at most. After CURRENT_LIMIT_TIME_mSec at the 
+   limit it is reduced by CURRENT_LIMIT_TIME_FACTOR. */
+#define CURRENT_LIMIT_START_FACTOR      2.0f
+#define CURRENT_LIMIT_FOLDBACK_FACTOR   0.25f
+#define CURRENT_LIMIT_UPDATE_mSec       10
+#define CURRENT_LIMIT_SLEW_AMPS_S       20.0f
+#define CURRENT_LIMIT_TIME_mSec         500
+#define CURRENT_LIMIT_TIME_FACTOR       0.8f
+
+/* Thermal model : the temperature estimates of the winding and the inverter
+   are updated every THERMAL_MODEL_UPDATE_mSec, 1.0 is the steady state 
+   temperature at the rated current. The current limit is reduced from 
+   THERMAL_DERATING_START to THERMAL_DERATING_END down to 
+   THERMAL_DERATING_MIN_FACTOR, the motor trips above THERMAL_TRIP_LEVEL. */
+#define THERMAL_MODEL_UPDATE_mSec       100
+#define THERMAL_DERATING_START          1.0f
+#define THERMAL_DERATING_END            1.2f
+#define THERMAL_DERATING_MIN_FACTOR     0.5f
+#define THERMAL_TRIP_LEVEL              1.3f
+
+/* Load torque observer : the load torque is estimated from the motor 
+   current, the speed and the inertia of the motor and of the load
+   (unit : kg.m^2), the estimate follows load steps with the observer 
+   bandwidth (unit : rad/s). Define LOAD_OBSERVER to feed the estimate 
+   forward to the duty cycle of the speed loop, LOAD_OBSERVER_FF_GAIN (0 to 1)
+   is the part of the estimate fed forward. */
+#undef LOAD_OBSERVER
+#define LOAD_INERTIA_KGM2               0.0f
+#define LOAD_OBSERVER_BANDWIDTH_RAD_S   50.0f
+#define LOAD_OBSERVER_FF_GAIN           1.0f
+
+/* Fault retry : transient and recoverable faults restart the motor after 
+   FAULT_RETRY_DELAY_mSec, the delay of a recoverable fault doubles every 
+   retry up to FAULT_RETRY_DELAY_MAX_mSec. More than FAULT_RETRY_MAX retries
+   within FAULT_RETRY_WINDOW_mSec latch the fault till reset, 
+   FAULT_RETRY_MAX = 0 latches every fault. */
+#define FAULT_RETRY_MAX                 3
+#define FAULT_RETRY_DELAY_mSec          50
+#define FAULT_RETRY_DELAY_MAX_mSec      2000
+#define FAULT_RETRY_WINDOW_mSec         60000
+
+/* Power meter : the input power sampled every control loop is aggregated in
+   blocks of POWER_METER_BLOCK_mSec in the main loop, the efficiency is 
+   estimated above POWER_METER_MIN_POWER_W (unit : watts) */
+#define POWER_METER_BLOCK_mSec          10
+#define POWER_METER_MIN_POWER_W         1.0f
+
+/* Task scheduler of the control loop interrupt : execution time budget of 
+   the slots (unit : nano seconds) and control loop of the first execution 
+   of the slow slots. The budgets of all the slots must fit in the control 
+   loop period, this is checked at compile time. */
+#define SCHEDULER_CONTROL_BUDGET_nSec       30000
+#define SCHEDULER_CURRENT_LIMIT_BUDGET_nSec 3000
+#define SCHEDULER_THERMAL_BUDGET_nSec       5000
+#define SCHEDULER_CURRENT_LIMIT_PHASE       1
+#define SCHEDULER_THERMAL_PHASE             2
+
+/* Scaling of maximum speed and rated current when the motor runs on two Hall
+   sensors after a Hall input failure */
+#define HALL_DEGRADED_LIMIT_FACTOR      0.5f
 // </editor-fold>
 
 #ifdef __cplusplus
@@ -0,0 +1,211 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * power_meter.c
+ *
+ * This file implements the input power and energy meter. The input power is
+ * the DC bus voltage times the bus current during the PWM on time times the
+ * duty ratio, the electromagnetic power is the BEMF times the on time 
+ * current.
+ *
+ *
+ * Component: METERING
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "power_meter.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_PowerMeterInit(&pMeter, blockSamples, sampleTime) </B>
+*
+* @brief Function to initialize the power meter and clear the energy 
+*        counters. The signal pointers, the duty scale, the BEMF constant and
+*        the minimum power are set by the application after the 
+*        initialization.
+*
+* @param Pointer to the data structure containing power meter parameters.
+* @param Samples per block.
+* @param Time between samples (unit : seconds).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_PowerMeterInit(&pMeter, 200, 0.00005f); </CODE>
+*
+*/
+void MCAPP_PowerMeterInit(MCAPP_POWER_METER_T *pMeter, uint32_t blockSamples,
+                                                            float sampleTime)
+{
+    pMeter->blockSamples = blockSamples;
+    pMeter->sampleTime = sampleTime;
+    pMeter->pDuty = NULL;
+    pMeter->power = 0.0f;
+    pMeter->sumPower = 0.0f;
+    pMeter->sumCurrent = 0.0f;
+    pMeter->sampleCount = 0;
+    pMeter->blockReady = 0;
+    pMeter->residue = 0.0f;
+    pMeter->inputPower = 0.0f;
+    pMeter->mechanicalPower = 0.0f;
+    pMeter->efficiency = 0.0f;
+    pMeter->peakPower = 0.0f;
+    pMeter->runCount = 0;
+    pMeter->energyTotal = 0;
+    pMeter->energyRun = 0;
+    pMeter->running = 0;
+}
+
+/**
+* <B> Function: MCAPP_PowerMeterSample(&pMeter) </B>
+*
+* @brief Function executed every control loop while the motor runs to sample
+*        the input power, a completed block is handed to the main loop once 
+*        the previous block has been aggregated.
+*
+* @param Pointer to the data structure containing power meter parameters.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_PowerMeterSample(&pMeter); </CODE>
+*
+*/
+void MCAPP_PowerMeterSample(MCAPP_POWER_METER_T *pMeter)
+{
+    float current = *pMeter->pCurrent;
+    
+    pMeter->power = *pMeter->pVdc * current;
+    if(pMeter->pDuty != NULL)
+    {
+        pMeter->power = pMeter->power * 
+                                ((float)*pMeter->pDuty * pMeter->dutyScale);
+    }
+    pMeter->sumPower += pMeter->power;
+    pMeter->sumCurrent += current;
+    pMeter->sampleCount++;
+    
+    if((pMeter->sampleCount >= pMeter->blockSamples) && 
+                                                (pMeter->blockReady == 0))
+    {
+        pMeter->blockPower = pMeter->sumPower;
+        pMeter->blockCurrent = pMeter->sumCurrent;
+        pMeter->blockCount = pMeter->sampleCount;
+        pMeter->sumPower = 0.0f;
+        pMeter->sumCurrent = 0.0f;
+        pMeter->sampleCount = 0;
+        pMeter->blockReady = 1;
+    }
+}
+
+/**
+* <B> Function: MCAPP_PowerMeterAggregate(&pMeter, running) </B>
+*
+* @brief Function executed in the main loop to aggregate a completed block :
+*        (1) The run energy and peak power are cleared at the start of a run
+*        (2) The energy of the block is added to the energy counters, the 
+*            energy below one count is carried to the next block
+*        (3) The efficiency is estimated from the electromagnetic power, 
+*            ke x speed x on time current, and the input power
+*
+* @param Pointer to the data structure containing power meter parameters.
+* @param Motor running.
+* @return 1 if a block was aggregated.
+*
+* @example
+* <CODE> MCAPP_PowerMeterAggregate(&pMeter, running); </CODE>
+*
+*/
+bool MCAPP_PowerMeterAggregate(MCAPP_POWER_METER_T *pMeter, bool running)
+{
+    float energy, speed, current;
+    int64_t energyCount;
+    
+    if((running == 1) && (pMeter->running == 0))
+    {
+        pMeter->energyRun = 0;
+        pMeter->peakPower = 0.0f;
+        pMeter->runCount++;
+    }
+    pMeter->running = running;
+    
+    if(pMeter->blockReady == 0)
+    {
+        return 0;
+    }
+    
+    pMeter->inputPower = pMeter->blockPower / (float)pMeter->blockCount;
+    current = pMeter->blockCurrent / (float)pMeter->blockCount;
+    
+    energy = (pMeter->blockPower * pMeter->sampleTime * 1000.0f) + 
+                                                            pMeter->residue;
+    energyCount = (int64_t)energy;
+    pMeter->residue = energy - (float)energyCount;
+    pMeter->energyTotal += energyCount;
+    pMeter->energyRun += energyCount;
+    
+    /* The block is released to the ADC interrupt */
+    pMeter->blockReady = 0;
+    
+    if(pMeter->inputPower > pMeter->peakPower)
+    {
+        pMeter->peakPower = pMeter->inputPower;
+    }
+    
+    speed = *pMeter->pSpeed;
+    if(speed < 0.0f)
+    {
+        speed = -speed;
+    }
+    pMeter->mechanicalPower = pMeter->ke * speed * current;
+    if(pMeter->inputPower > pMeter->minPower)
+    {
+        pMeter->efficiency = pMeter->mechanicalPower / pMeter->inputPower;
+        if(pMeter->efficiency > 1.0f)
+        {
+            pMeter->efficiency = 1.0f;
+        }
+        else if(pMeter->efficiency < 0.0f)
+        {
+            pMeter->efficiency = 0.0f;
+        }
+    }
+    else
+    {
+        pMeter->efficiency = 0.0f;
+    }
+    
+    return 1;
+}
+
+// </editor-fold>
@@ -0,0 +1,96 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file power_meter_types.h
+ *
+ * @brief This module initializes data structure variable type definitions of
+ * the input power and energy meter structure
+ *
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef POWER_METER_TYPES_H
+#define	POWER_METER_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+#include <stdbool.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+typedef struct
+{
+    float
+        *pVdc,              /* Pointer for DC bus voltage */
+        *pCurrent,          /* Pointer for bus current during the PWM on time */
+        *pSpeed;            /* Pointer for measured speed */
+    uint32_t
+        *pDuty;             /* Pointer for PWM duty in PWM counts */
+    float
+        dutyScale,          /* Inverse of the PWM period in PWM counts */
+        sampleTime,         /* Time between samples (unit : seconds) */
+        ke,                 /* Line to line BEMF constant (unit : V/RPM) */
+        minPower,           /* Input power to estimate efficiency (unit : W) */
+        power,              /* Instantaneous input power (unit : W) */
+        sumPower,           /* Sum of input power of the present block */
+        sumCurrent,         /* Sum of on time current of the present block */
+        blockPower,         /* Sum of input power of the completed block */
+        blockCurrent,       /* Sum of on time current of the completed block */
+        residue,            /* Energy below one count (unit : mJ) */
+        inputPower,         /* Input power of the last block (unit : W) */
+        mechanicalPower,    /* Electromagnetic power estimate (unit : W) */
+        efficiency,         /* Efficiency estimate, 0 below minPower */
+        peakPower;          /* Peak input power of the present run (unit : W) */
+    uint32_t
+        blockSamples,       /* Samples per block */
+        sampleCount,        /* Samples of the present block */
+        blockCount,         /* Samples of the completed block */
+        runCount;           /* Number of runs */
+    int64_t
+        energyTotal,        /* Input energy since power on (unit : mJ) */
+        energyRun;          /* Input energy of the present run (unit : mJ) */
+    volatile bool
+        blockReady;         /* Completed block not aggregated yet */
+    bool
+        running;            /* Motor running at the last aggregation */
+}MCAPP_POWER_METER_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* POWER_METER_TYPES_H */
+
@@ -65,6 +65,29 @@ extern "C" {
 #define DIRECTION_CHANGE_SPEED_RPM                    25.0f
 /* Motor Rated Bus Current in RMS (unit : amps) */
 #define NOMINAL_CURRENT_BUS_RMS                       1.0f
+/* Winding thermal time constant (unit : seconds) */
+#define WINDING_THERMAL_TIME_CONSTANT_SEC             300.0f
+/* Line to line peak BEMF constant (unit : volts/1000 RPM) */
+#define MOTOR_KE_VOLTS_PER_KRPM                       7.24f
+/* Line to line winding resistance (unit : ohms) */
+#define MOTOR_RESISTANCE_LL_OHM                       4.20f
+/* Rotor inertia (unit : kg.m^2) */
+#define MOTOR_INERTIA_KGM2                            0.0000028f
+
+/* Speed to start advancing the commutation (unit : RPM) */
+#define PHASE_ADVANCE_START_RPM                       1250.0f
+/* Commutation advance at maximum speed (unit : electrical degrees) */
+#define PHASE_ADVANCE_MAX_DEG                         10.0f
+
+/* Speed to change to sinusoidal commutation (unit : RPM) */
+#define SINE_COMMUTATION_ENTRY_RPM                    250.0f
+/* Speed to change back to six-step commutation (unit : RPM) */
+#define SINE_COMMUTATION_EXIT_RPM                     200.0f
+
+/* Acceleration limit of the speed reference (unit : RPM/s) */
+#define SPEED_TRAJECTORY_ACCEL_RPM_S                  2500.0f
+/* Rate of change limit of the acceleration (unit : RPM/s^2) */
+#define SPEED_TRAJECTORY_JERK_RPM_S2                  10000.0f
 
 /*PI Controller Parameters*/    
 /* Speed Control Loop - PI Coefficients */
@@ -0,0 +1,291 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * current_limit.c
+ *
+ * This file implements the dynamic current limit. The cycle-by-cycle current
+ * limit threshold follows the speed foldback table, the temperature estimate
+ * and the time at limit, and the current limit events are counted.
+ *
+ *
+ * Component: PROTECTION
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "current_limit.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+static float MCAPP_CurrentLimitFoldback(MCAPP_CURRENT_LIMIT_T *, float);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_CurrentLimitInit(&pLimit, pFoldback, points, 
+*                                                           limitMax) </B>
+*
+* @brief Function to initialize the dynamic current limit with the foldback 
+*        table, the limit starts from the first point of the table. The 
+*        update timing parameters are set by the application after the 
+*        initialization.
+*
+* @param Pointer to the data structure containing current limit parameters.
+* @param Foldback table in ascending speed order.
+* @param Number of points of the foldback table.
+* @param Current limit never exceeded (unit : amps).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_CurrentLimitInit(&pLimit, foldback, 3, 7.0f); </CODE>
+*
+*/
+void MCAPP_CurrentLimitInit(MCAPP_CURRENT_LIMIT_T *pLimit, 
+        const MCAPP_CURRENT_LIMIT_POINT_T *pFoldback, uint16_t points, 
+                                                            float limitMax)
+{
+    pLimit->pFoldback = pFoldback;
+    pLimit->points = points;
+    pLimit->limitMax = limitMax;
+    pLimit->pTemperature = NULL;
+    pLimit->limit = MCAPP_CurrentLimitFoldback(pLimit, pFoldback[0].speed);
+    pLimit->dacValue = 0;
+    pLimit->timeAtLimit = 0;
+    pLimit->secondCounter = 0;
+    pLimit->eventCounter = 0;
+    pLimit->eventsPerSecond = 0;
+    pLimit->eventCount = 0;
+    pLimit->active = 0;
+    pLimit->timeFoldback = 0;
+}
+
+/**
+* <B> Function: MCAPP_CurrentLimitDeratingSet(&pLimit, pTemperature, 
+*                                       deratingStart, deratingEnd, 
+*                                       deratingMin) </B>
+*
+* @brief Function to reduce the current limit with a temperature estimate,
+*        the limit is reduced linearly from 1 at deratingStart to 
+*        deratingMin at deratingEnd.
+*
+* @param Pointer to the data structure containing current limit parameters.
+* @param Pointer for temperature estimate.
+* @param Temperature estimate to start derating.
+* @param Temperature estimate of the largest derating.
+* @param Current limit factor at the largest derating.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_CurrentLimitDeratingSet(&pLimit, &temperature, 0.8f, 1.0f, 
+*                                                               0.5f); </CODE>
+*
+*/
+void MCAPP_CurrentLimitDeratingSet(MCAPP_CURRENT_LIMIT_T *pLimit, 
+        float *pTemperature, float deratingStart, float deratingEnd, 
+                                                        float deratingMin)
+{
+    pLimit->deratingStart = deratingStart;
+    pLimit->deratingEnd = deratingEnd;
+    pLimit->deratingMin = deratingMin;
+    pLimit->pTemperature = pTemperature;
+}
+
+/**
+* <B> Function: MCAPP_CurrentLimitMonitor(&pLimit, limitActive) </B>
+*
+* @brief Function executed every control loop :
+*        (1) Count the current limit events (start of limiting) per second
+*        (2) Count the time at limit, the limit is reduced by timeFactor 
+*            once the time at limit reaches timeAtLimitMax and restored when 
+*            the time at limit has decayed to zero
+*
+* @param Pointer to the data structure containing current limit parameters.
+* @param Cycle-by-cycle current limit is active.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_CurrentLimitMonitor(&pLimit, limitActive); </CODE>
+*
+*/
+void MCAPP_CurrentLimitMonitor(MCAPP_CURRENT_LIMIT_T *pLimit, bool limitActive)
+{
+    if((limitActive == 1) && (pLimit->active == 0))
+    {
+        pLimit->eventCounter++;
+        pLimit->eventCount++;
+    }
+    pLimit->active = limitActive;
+    
+    pLimit->secondCounter++;
+    if(pLimit->secondCounter >= pLimit->secondCount)
+    {
+        pLimit->eventsPerSecond = pLimit->eventCounter;
+        pLimit->eventCounter = 0;
+        pLimit->secondCounter = 0;
+    }
+    
+    if(limitActive == 1)
+    {
+        if(pLimit->timeAtLimit < pLimit->timeAtLimitMax)
+        {
+            pLimit->timeAtLimit++;
+        }
+        else
+        {
+            pLimit->timeFoldback = 1;
+        }
+    }
+    else if(pLimit->timeAtLimit > 0)
+    {
+        pLimit->timeAtLimit--;
+    }
+    else
+    {
+        pLimit->timeFoldback = 0;
+    }
+}
+
+/**
+* <B> Function: MCAPP_CurrentLimitUpdate(&pLimit) </B>
+*
+* @brief Function executed at the update rate to compute the limit from the 
+*        foldback table, the temperature derating and the time at limit, and
+*        move the present limit towards it by limitStep at most.
+*
+* @param Pointer to the data structure containing current limit parameters.
+* @return 1 = the DAC reference of the limit changed.
+*
+* @example
+* <CODE> MCAPP_CurrentLimitUpdate(&pLimit); </CODE>
+*
+*/
+bool MCAPP_CurrentLimitUpdate(MCAPP_CURRENT_LIMIT_T *pLimit)
+{
+    float limit, temperature, factor;
+    uint16_t dacValue;
+
+    limit = MCAPP_CurrentLimitFoldback(pLimit, *pLimit->pSpeed);
+    
+    if(pLimit->pTemperature != NULL)
+    {
+        temperature = *pLimit->pTemperature;
+        if(temperature >= pLimit->deratingEnd)
+        {
+            limit = limit * pLimit->deratingMin;
+        }
+        else if(temperature > pLimit->deratingStart)
+        {
+            factor = 1.0f - ((1.0f - pLimit->deratingMin) * 
+                        (temperature - pLimit->deratingStart) / 
+                        (pLimit->deratingEnd - pLimit->deratingStart));
+            limit = limit * factor;
+        }
+    }
+    if(pLimit->timeFoldback == 1)
+    {
+        limit = limit * pLimit->timeFactor;
+    }
+    
+    /* Limited change of the limit per update */
+    if(limit > (pLimit->limit + pLimit->limitStep))
+    {
+        limit = pLimit->limit + pLimit->limitStep;
+    }
+    else if(limit < (pLimit->limit - pLimit->limitStep))
+    {
+        limit = pLimit->limit - pLimit->limitStep;
+    }
+    pLimit->limit = limit;
+    
+    dacValue = (uint16_t)((limit * pLimit->dacScale) + pLimit->dacOffset);
+    if(dacValue == pLimit->dacValue)
+    {
+        return 0;
+    }
+    pLimit->dacValue = dacValue;
+    return 1;
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_CurrentLimitFoldback(&pLimit, speed) </B>
+*
+* @brief Function to interpolate the foldback table at the speed, the limit
+*        is held beyond the first and the last point.
+*
+* @param Pointer to the data structure containing current limit parameters.
+* @param Speed (unit : RPM).
+* @return Current limit (unit : amps).
+*
+* @example
+* <CODE> limit = MCAPP_CurrentLimitFoldback(&pLimit, speed); </CODE>
+*
+*/
+static float MCAPP_CurrentLimitFoldback(MCAPP_CURRENT_LIMIT_T *pLimit, 
+                                                                float speed)
+{
+    const MCAPP_CURRENT_LIMIT_POINT_T *pPoint = pLimit->pFoldback;
+    float limit;
+    uint16_t index;
+
+    limit = pPoint[pLimit->points - 1].current;
+    if(speed <= pPoint[0].speed)
+    {
+        limit = pPoint[0].current;
+    }
+    else
+    {
+        for(index = 1; index < pLimit->points; index++)
+        {
+            if(speed < pPoint[index].speed)
+            {
+                limit = pPoint[index - 1].current + 
+                    ((pPoint[index].current - pPoint[index - 1].current) * 
+                        (speed - pPoint[index - 1].speed) / 
+                        (pPoint[index].speed - pPoint[index - 1].speed));
+                break;
+            }
+        }
+    }
+    if(limit > pLimit->limitMax)
+    {
+        limit = pLimit->limitMax;
+    }
+    return limit;
+}
+
+// </editor-fold>
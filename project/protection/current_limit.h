@@ -0,0 +1,74 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file current_limit.h
+ *
+ * @brief This header file lists interface functions of the dynamic current 
+ * limit.
+ *
+ * Note : The cycle-by-cycle current limit threshold (comparator 3 DAC) is 
+ * computed from a speed foldback table, reduced with the temperature 
+ * estimate and reduced after the current is at the limit for a time. The 
+ * threshold is updated at a reduced rate and its change per update is 
+ * limited.
+ *
+ * Component: PROTECTION
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef CURRENT_LIMIT_H
+#define	CURRENT_LIMIT_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "current_limit_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_CurrentLimitInit(MCAPP_CURRENT_LIMIT_T *, 
+                    const MCAPP_CURRENT_LIMIT_POINT_T *, uint16_t, float);
+void MCAPP_CurrentLimitDeratingSet(MCAPP_CURRENT_LIMIT_T *, float *, float, 
+                                                                float, float);
+void MCAPP_CurrentLimitMonitor(MCAPP_CURRENT_LIMIT_T *, bool);
+bool MCAPP_CurrentLimitUpdate(MCAPP_CURRENT_LIMIT_T *);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* CURRENT_LIMIT_H */
+
@@ -0,0 +1,98 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file current_limit_types.h
+ *
+ * @brief This module initializes data structure variable type definitions of
+ * the dynamic current limit structure
+ *
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef CURRENT_LIMIT_TYPES_H
+#define	CURRENT_LIMIT_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+#include <stdbool.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+typedef struct
+{
+    float
+        speed,              /* Speed of the foldback point (unit : RPM) */
+        current;            /* Current limit at the speed (unit : amps) */
+}MCAPP_CURRENT_LIMIT_POINT_T;
+
+typedef struct
+{
+    const MCAPP_CURRENT_LIMIT_POINT_T
+        *pFoldback;         /* Foldback table in ascending speed order */
+    float
+        *pSpeed,            /* Pointer for measured speed */
+        *pTemperature,      /* Pointer for temperature estimate, NULL = none */
+        limitMax,           /* Current limit never exceeded (unit : amps) */
+        limitStep,          /* Largest change of the limit per update */
+        deratingStart,      /* Temperature estimate to start derating */
+        deratingEnd,        /* Temperature estimate of the largest derating */
+        deratingMin,        /* Current limit factor at the largest derating */
+        timeFactor,         /* Current limit factor after time at limit */
+        dacScale,           /* DAC counts per amp */
+        dacOffset,          /* DAC counts at zero current */
+        limit;              /* Present current limit (unit : amps) */
+    uint16_t
+        points,             /* Number of points of the foldback table */
+        timeAtLimit,        /* Control loops at limit, decays off limit */
+        timeAtLimitMax,     /* Control loops at limit to reduce the limit */
+        secondCount,        /* Control loops per second */
+        secondCounter,      /* Control loops since the start of the second */
+        eventCounter,       /* Limit events in the present second */
+        eventsPerSecond,    /* Limit events in the last second */
+        dacValue;           /* DAC reference of the present limit */
+    uint32_t
+        eventCount;         /* Total limit events */
+    bool
+        active,             /* Cycle-by-cycle current limit active */
+        timeFoldback;       /* Limit reduced after time at limit */
+}MCAPP_CURRENT_LIMIT_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* CURRENT_LIMIT_TYPES_H */
+
@@ -0,0 +1,212 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * fault_manager.c
+ *
+ * This file implements the fault manager. A fault is classified by the class
+ * table, a transient or recoverable fault schedules a retry with a bounded 
+ * exponential backoff and too many retries within the window latch it.
+ *
+ *
+ * Component: PROTECTION
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fault_manager.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_FaultManagerInit(&pManager, pClass, codes, retryMax,
+*                                           delayMin, delayMax, window) </B>
+*
+* @brief Function to initialize the fault manager and clear the retry 
+*        counters. A fault code outside the class table is fatal, retryMax 
+*        = 0 latches every fault.
+*
+* @param Pointer to the data structure containing fault manager parameters.
+* @param Class of each fault code, MCAPP_FAULT_CLASS_T.
+* @param Number of fault codes of the class table.
+* @param Retries in the window before the fault is latched.
+* @param Delay of the first retry (unit : ticks).
+* @param Largest retry delay (unit : ticks).
+* @param Window of the retry count (unit : ticks).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_FaultManagerInit(&pManager, faultClass, 10, 3, 1000, 
+*                                                   100000, 1200000); </CODE>
+*
+*/
+void MCAPP_FaultManagerInit(MCAPP_FAULT_MANAGER_T *pManager, 
+        const uint8_t *pClass, uint16_t codes, uint16_t retryMax, 
+                        uint32_t delayMin, uint32_t delayMax, uint32_t window)
+{
+    pManager->pClass = pClass;
+    pManager->codes = codes;
+    pManager->retryMax = retryMax;
+    pManager->delayMin = delayMin;
+    pManager->delayMax = delayMax;
+    pManager->window = window;
+    pManager->retryTotal = 0;
+    pManager->escalationCount = 0;
+    MCAPP_FaultManagerReset(pManager);
+}
+
+/**
+* <B> Function: MCAPP_FaultManagerReset(&pManager) </B>
+*
+* @brief Function to release a latched fault and restart the retry window, 
+*        the counters since initialization are kept.
+*
+* @param Pointer to the data structure containing fault manager parameters.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_FaultManagerReset(&pManager); </CODE>
+*
+*/
+void MCAPP_FaultManagerReset(MCAPP_FAULT_MANAGER_T *pManager)
+{
+    pManager->fault = 0;
+    pManager->faultClass = FAULT_CLASS_TRANSIENT;
+    pManager->retryCount = 0;
+    pManager->windowStart = 0;
+    pManager->faultTick = 0;
+    pManager->delay = 0;
+    pManager->backoff = pManager->delayMin;
+    pManager->latched = 0;
+}
+
+/**
+* <B> Function: MCAPP_FaultManagerFault(&pManager, fault, tick) </B>
+*
+* @brief Function to classify a fault and schedule its retry :
+*        (1) The first fault, or a fault after the window of the previous 
+*            faults elapsed, starts a new window with the first retry delay
+*        (2) A fatal fault, or a fault after retryMax retries in the window, 
+*            is latched
+*        (3) A transient fault is retried after the first retry delay
+*        (4) A recoverable fault is retried after the backoff delay, which 
+*            doubles up to the largest delay
+*
+* @param Pointer to the data structure containing fault manager parameters.
+* @param Fault code.
+* @param Present tick.
+* @return 1 = retry scheduled, 0 = fault latched.
+*
+* @example
+* <CODE> retry = MCAPP_FaultManagerFault(&pManager, 1, tick); </CODE>
+*
+*/
+bool MCAPP_FaultManagerFault(MCAPP_FAULT_MANAGER_T *pManager, uint16_t fault,
+                                                                uint32_t tick)
+{
+    pManager->fault = fault;
+    pManager->faultTick = tick;
+    if(fault < pManager->codes)
+    {
+        pManager->faultClass = pManager->pClass[fault];
+    }
+    else
+    {
+        pManager->faultClass = FAULT_CLASS_FATAL;
+    }
+    
+    /* Unsigned difference handles the tick roll over */
+    if((pManager->retryCount == 0) || 
+                            ((tick - pManager->windowStart) >= pManager->window))
+    {
+        pManager->windowStart = tick;
+        pManager->retryCount = 0;
+        pManager->backoff = pManager->delayMin;
+    }
+    
+    if(pManager->faultClass == FAULT_CLASS_FATAL)
+    {
+        pManager->latched = 1;
+    }
+    else if(pManager->retryCount >= pManager->retryMax)
+    {
+        pManager->latched = 1;
+        pManager->escalationCount++;
+    }
+    else if(pManager->faultClass == FAULT_CLASS_TRANSIENT)
+    {
+        pManager->delay = pManager->delayMin;
+    }
+    else
+    {
+        pManager->delay = pManager->backoff;
+        if(pManager->backoff > (pManager->delayMax >> 1))
+        {
+            pManager->backoff = pManager->delayMax;
+        }
+        else
+        {
+            pManager->backoff = pManager->backoff << 1;
+        }
+    }
+    
+    if(pManager->latched == 1)
+    {
+        return 0;
+    }
+    pManager->retryCount++;
+    pManager->retryTotal++;
+    return 1;
+}
+
+/**
+* <B> Function: MCAPP_FaultManagerRetryDue(&pManager, tick) </B>
+*
+* @brief Function to check if the delay of the scheduled retry elapsed.
+*
+* @param Pointer to the data structure containing fault manager parameters.
+* @param Present tick.
+* @return 1 = retry due, 0 = retry delay running or fault latched.
+*
+* @example
+* <CODE> retry = MCAPP_FaultManagerRetryDue(&pManager, tick); </CODE>
+*
+*/
+bool MCAPP_FaultManagerRetryDue(MCAPP_FAULT_MANAGER_T *pManager, uint32_t tick)
+{
+    if(pManager->latched == 1)
+    {
+        return 0;
+    }
+    return ((tick - pManager->faultTick) >= pManager->delay);
+}
+
+// </editor-fold>
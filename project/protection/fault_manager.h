@@ -0,0 +1,72 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file fault_manager.h
+ *
+ * @brief This header file lists interface functions of the fault manager.
+ *
+ * Note : Every fault code is classified as transient, recoverable or fatal by
+ * a class table. Transient and recoverable faults are retried after a delay,
+ * the delay of the recoverable faults doubles every retry up to a maximum.
+ * More than the allowed number of retries within the window latches the 
+ * fault as a fatal fault. Time is counted in ticks of the caller.
+ *
+ * Component: PROTECTION
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef FAULT_MANAGER_H
+#define	FAULT_MANAGER_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fault_manager_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_FaultManagerInit(MCAPP_FAULT_MANAGER_T *, const uint8_t *, 
+                                uint16_t, uint16_t, uint32_t, uint32_t, uint32_t);
+void MCAPP_FaultManagerReset(MCAPP_FAULT_MANAGER_T *);
+bool MCAPP_FaultManagerFault(MCAPP_FAULT_MANAGER_T *, uint16_t, uint32_t);
+bool MCAPP_FaultManagerRetryDue(MCAPP_FAULT_MANAGER_T *, uint32_t);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* FAULT_MANAGER_H */
+
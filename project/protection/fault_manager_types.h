@@ -0,0 +1,94 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file fault_manager_types.h
+ *
+ * @brief This module initializes data structure variable type definitions of
+ * the fault manager
+ *
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef FAULT_MANAGER_TYPES_H
+#define	FAULT_MANAGER_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+#include <stdbool.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+typedef enum
+{
+    /* Restarted after the shortest delay, the backoff is not increased */
+    FAULT_CLASS_TRANSIENT = 0,
+    /* Restarted after the backoff delay, doubled every retry */
+    FAULT_CLASS_RECOVERABLE = 1,
+    /* Latched till reset, not restarted */
+    FAULT_CLASS_FATAL = 2,
+
+}MCAPP_FAULT_CLASS_T;
+
+typedef struct
+{
+    const uint8_t
+        *pClass;            /* Class of each fault code, MCAPP_FAULT_CLASS_T */
+    uint16_t
+        codes,              /* Number of fault codes of the class table */
+        retryMax,           /* Retries in the window before escalation */
+        fault,              /* Last fault code */
+        faultClass,         /* Class of the last fault */
+        retryCount;         /* Retries in the present window */
+    uint32_t
+        delayMin,           /* Retry delay of the first retry (unit : ticks) */
+        delayMax,           /* Largest retry delay (unit : ticks) */
+        window,             /* Window of the retry count (unit : ticks) */
+        windowStart,        /* Tick of the first fault of the window */
+        faultTick,          /* Tick of the last fault */
+        delay,              /* Delay of the pending retry (unit : ticks) */
+        backoff,            /* Delay of the next recoverable fault retry */
+        retryTotal,         /* Retries since initialization */
+        escalationCount;    /* Faults latched by too many retries */
+    bool
+        latched;            /* Fault latched, no retry */
+}MCAPP_FAULT_MANAGER_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* FAULT_MANAGER_TYPES_H */
+
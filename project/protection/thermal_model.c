@@ -0,0 +1,259 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * thermal_model.c
+ *
+ * This file implements the winding and inverter thermal model. The mean 
+ * square current of each update drives two first order thermal 
+ * networks, the highest temperature estimate derates the current limit and
+ * trips the motor, the remaining peak torque boost time is estimated.
+ *
+ *
+ * Component: PROTECTION
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "thermal_model.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+static void MCAPP_ThermalNetworkUpdate(MCAPP_THERMAL_NETWORK_T *, float);
+static float MCAPP_ThermalBoostTime(MCAPP_THERMAL_NETWORK_T *, float, float);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_ThermalModelInit(&pThermal) </B>
+*
+* @brief Function to initialize the thermal model with the motor and the 
+*        inverter at ambient temperature. The thermal networks, the boost 
+*        current and the temperature levels are set by the application after
+*        the initialization.
+*
+* @param Pointer to the data structure containing thermal model parameters.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_ThermalModelInit(&pThermal); </CODE>
+*
+*/
+void MCAPP_ThermalModelInit(MCAPP_THERMAL_MODEL_T *pThermal)
+{
+    pThermal->sampleCount = 0;
+    pThermal->sumSquare = 0.0f;
+    pThermal->winding.temperature = 0.0f;
+    pThermal->inverter.temperature = 0.0f;
+    pThermal->temperature = 0.0f;
+    pThermal->headroom = 1.0f;
+    pThermal->boostTime = -1.0f;
+    pThermal->trip = 0;
+}
+
+/**
+* <B> Function: MCAPP_ThermalNetworkSet(&pNetwork, timeConstant, 
+*                                           ratedCurrent, updateTime) </B>
+*
+* @brief Function to set the parameters of a thermal network.
+*
+* @param Pointer to the data structure containing thermal network parameters.
+* @param Thermal time constant (unit : seconds).
+* @param Continuous current rating (unit : amps).
+* @param Time between model updates (unit : seconds).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_ThermalNetworkSet(&pNetwork, 600.0f, 3.4f, 0.1f); </CODE>
+*
+*/
+void MCAPP_ThermalNetworkSet(MCAPP_THERMAL_NETWORK_T *pNetwork, 
+                    float timeConstant, float ratedCurrent, float updateTime)
+{
+    pNetwork->timeConstant = timeConstant;
+    pNetwork->ratedCurrent = ratedCurrent;
+    pNetwork->factor = updateTime / timeConstant;
+}
+
+/**
+* <B> Function: MCAPP_ThermalModelSample(&pThermal, current) </B>
+*
+* @brief Function executed every control loop, also while the motor is not
+*        running, to accumulate the square of the current.
+*
+* @param Pointer to the data structure containing thermal model parameters.
+* @param Measured current, zero while the motor is not running (unit : amps).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_ThermalModelSample(&pThermal, current); </CODE>
+*
+*/
+void MCAPP_ThermalModelSample(MCAPP_THERMAL_MODEL_T *pThermal, float current)
+{
+    pThermal->sumSquare += current * current;
+    pThermal->sampleCount++;
+}
+
+/**
+* <B> Function: MCAPP_ThermalModelUpdate(&pThermal) </B>
+*
+* @brief Function executed at the update rate to update the thermal networks 
+*        with the mean square current of the samples since the last update.
+*        The trip is released once the temperature estimate is below the 
+*        derating start.
+*
+* @param Pointer to the data structure containing thermal model parameters.
+* @return 1 while the temperature estimate is above the trip level.
+*
+* @example
+* <CODE> trip = MCAPP_ThermalModelUpdate(&pThermal); </CODE>
+*
+*/
+bool MCAPP_ThermalModelUpdate(MCAPP_THERMAL_MODEL_T *pThermal)
+{
+    float meanSquare, windingTime, inverterTime;
+
+    if(pThermal->sampleCount == 0)
+    {
+        return pThermal->trip;
+    }
+    meanSquare = pThermal->sumSquare / (float)pThermal->sampleCount;
+    pThermal->sumSquare = 0.0f;
+    pThermal->sampleCount = 0;
+    
+    MCAPP_ThermalNetworkUpdate(&pThermal->winding, meanSquare);
+    MCAPP_ThermalNetworkUpdate(&pThermal->inverter, meanSquare);
+    
+    pThermal->temperature = pThermal->winding.temperature;
+    if(pThermal->inverter.temperature > pThermal->temperature)
+    {
+        pThermal->temperature = pThermal->inverter.temperature;
+    }
+    
+    pThermal->headroom = 1.0f - 
+                        (pThermal->temperature / pThermal->deratingStart);
+    if(pThermal->headroom < 0.0f)
+    {
+        pThermal->headroom = 0.0f;
+    }
+    
+    /* The network reaching the derating start first limits the boost */
+    windingTime = MCAPP_ThermalBoostTime(&pThermal->winding, 
+                        pThermal->boostCurrent, pThermal->deratingStart);
+    inverterTime = MCAPP_ThermalBoostTime(&pThermal->inverter, 
+                        pThermal->boostCurrent, pThermal->deratingStart);
+    if((windingTime < 0.0f) || 
+                ((inverterTime >= 0.0f) && (inverterTime < windingTime)))
+    {
+        pThermal->boostTime = inverterTime;
+    }
+    else
+    {
+        pThermal->boostTime = windingTime;
+    }
+    
+    if(pThermal->temperature > pThermal->tripLevel)
+    {
+        pThermal->trip = 1;
+    }
+    else if(pThermal->temperature < pThermal->deratingStart)
+    {
+        pThermal->trip = 0;
+    }
+    
+    return pThermal->trip;
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_ThermalNetworkUpdate(&pNetwork, meanSquare) </B>
+*
+* @brief Function to update the temperature of a first order thermal network,
+*        the temperature approaches (I / ratedCurrent)^2 with the thermal 
+*        time constant.
+*
+* @param Pointer to the data structure containing thermal network parameters.
+* @param Mean square current of the update interval (unit : amps^2).
+* @return none.
+*
+* @example
+* <CODE> MCAPP_ThermalNetworkUpdate(&pNetwork, meanSquare); </CODE>
+*
+*/
+static void MCAPP_ThermalNetworkUpdate(MCAPP_THERMAL_NETWORK_T *pNetwork, 
+                                                            float meanSquare)
+{
+    float load = meanSquare / (pNetwork->ratedCurrent * pNetwork->ratedCurrent);
+
+    pNetwork->temperature += (load - pNetwork->temperature) * pNetwork->factor;
+}
+
+/**
+* <B> Function: MCAPP_ThermalBoostTime(&pNetwork, boostCurrent, level) </B>
+*
+* @brief Function to compute the time for a thermal network to reach the 
+*        temperature level from the present temperature at the boost current.
+*
+* @param Pointer to the data structure containing thermal network parameters.
+* @param Current of the peak torque boost (unit : amps).
+* @param Temperature level.
+* @return Time to reach the level (unit : seconds), 0 if the level is reached
+*         and negative if the boost current does not reach the level.
+*
+* @example
+* <CODE> time = MCAPP_ThermalBoostTime(&pNetwork, 6.8f, 1.0f); </CODE>
+*
+*/
+static float MCAPP_ThermalBoostTime(MCAPP_THERMAL_NETWORK_T *pNetwork, 
+                                            float boostCurrent, float level)
+{
+    float load = (boostCurrent * boostCurrent) / 
+                        (pNetwork->ratedCurrent * pNetwork->ratedCurrent);
+
+    if(load <= level)
+    {
+        return -1.0f;
+    }
+    if(pNetwork->temperature >= level)
+    {
+        return 0.0f;
+    }
+    return pNetwork->timeConstant * 
+            logf((load - pNetwork->temperature) / (load - level));
+}
+
+// </editor-fold>
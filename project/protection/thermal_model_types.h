@@ -0,0 +1,93 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file thermal_model_types.h
+ *
+ * @brief This module initializes data structure variable type definitions of
+ * the winding and inverter thermal model structure
+ *
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef THERMAL_MODEL_TYPES_H
+#define	THERMAL_MODEL_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+#include <stdbool.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+/**
+ * First order thermal network. The temperature is the temperature rise over 
+ * ambient normalized to the steady state rise at the rated current, 1.0 is 
+ * reached after continuous operation at the rated current.
+*/
+typedef struct
+{
+    float
+        ratedCurrent,       /* Continuous current rating (unit : amps) */
+        factor,             /* Update time / thermal time constant */
+        timeConstant,       /* Thermal time constant (unit : seconds) */
+        temperature;        /* Normalized temperature rise estimate */
+}MCAPP_THERMAL_NETWORK_T;
+
+typedef struct
+{
+    MCAPP_THERMAL_NETWORK_T
+        winding,            /* Motor winding thermal network */
+        inverter;           /* Inverter thermal network */
+    float
+        sumSquare,          /* Sum of squared current since the last update */
+        boostCurrent,       /* Current of the peak torque boost (unit : amps) */
+        deratingStart,      /* Temperature to start derating the current */
+        tripLevel,          /* Temperature to trip the motor */
+        temperature,        /* Highest temperature of the networks */
+        headroom,           /* Temperature margin to deratingStart, 1 = cold */
+        boostTime;          /* Time at boostCurrent till derating starts 
+                               (unit : seconds), negative = unlimited */
+    uint16_t
+        sampleCount;        /* Control loops since the last update */
+    bool
+        trip;               /* Temperature above tripLevel */
+}MCAPP_THERMAL_MODEL_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* THERMAL_MODEL_TYPES_H */
+
@@ -42,75 +42,436 @@
 
 // </editor-fold>
 
-// <editor-fold defaultstate="expanded" desc="VARIABLES ">
-
-MCAPP_FILTER_LPF_T lowPassFilter;
-MCAPP_FILTER_AVG_T movingAvgFilter;
-
-// </editor-fold>
-
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
 
 /**
-* <B> Function: MCAPP_LowPassFilter((input) </B>
+* <B> Function: MCAPP_LowPassFilterInit(&pFilter, coefficient) </B>
+*
+* @brief Function to initialize first order low pass filter. 
+*        
+* @param Pointer to the data structure containing variables for LPF.
+* @param Filter coefficient, see FILTER_LPF_COEFF.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_LowPassFilterInit(&pFilter, coefficient); </CODE>
+*
+*/
+void MCAPP_LowPassFilterInit (MCAPP_FILTER_LPF_T *pFilter, float coefficient)
+{
+    pFilter->coefficient = coefficient;
+    pFilter->output = 0;
+}
+
+/**
+* <B> Function: MCAPP_LowPassFilter(&pFilter, input) </B>
 *
 * @brief Function to implement low pass filter. 
 *        
 * @param Pointer to the data structure containing variables for LPF.
+* @param Filter input.
 * @return filtered output.
 * 
 * @example
-* <CODE> MCAPP_LowPassFilter(input); </CODE>
+* <CODE> MCAPP_LowPassFilter(&pFilter, input); </CODE>
 *
 */
-float MCAPP_LowPassFilter (float input)
+float MCAPP_LowPassFilter (MCAPP_FILTER_LPF_T *pFilter, float input)
 {
     /* Filter input using a first order low-pass filter */
-    lowPassFilter.output = lowPassFilter.output + 
-            ((input - lowPassFilter.output) * LFP_CUTOFF_FREQUENCY);
+    pFilter->output = pFilter->output + 
+            ((input - pFilter->output) * pFilter->coefficient);
     
-    return lowPassFilter.output;
+    return pFilter->output;
 }
 
 /**
-* <B> Function: MCAPP_MovingAvgFilterInit(input) </B>
+* <B> Function: MCAPP_LowPassFilterQ15Init(&pFilter, coefficient) </B>
+*
+* @brief Function to initialize first order low pass filter in Q15 format. 
+*        
+* @param Pointer to the data structure containing variables for LPF.
+* @param Filter coefficient in Q15, see FILTER_LPF_COEFF and FILTER_Q15.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_LowPassFilterQ15Init(&pFilter, coefficient); </CODE>
+*
+*/
+void MCAPP_LowPassFilterQ15Init (MCAPP_FILTER_LPF_Q15_T *pFilter, 
+                                                        int16_t coefficient)
+{
+    pFilter->coefficient = coefficient;
+    pFilter->output = 0;
+}
+
+/**
+* <B> Function: MCAPP_LowPassFilterQ15(&pFilter, input) </B>
+*
+* @brief Function to implement low pass filter in Q15 format. 
+*        
+* @param Pointer to the data structure containing variables for LPF.
+* @param Filter input in Q15.
+* @return filtered output in Q15.
+* 
+* @example
+* <CODE> MCAPP_LowPassFilterQ15(&pFilter, input); </CODE>
+*
+*/
+int16_t MCAPP_LowPassFilterQ15 (MCAPP_FILTER_LPF_Q15_T *pFilter, int16_t input)
+{
+    int32_t error = (int32_t)input - pFilter->output;
+    
+    pFilter->output = (int16_t)(pFilter->output + 
+                            ((error * pFilter->coefficient) >> 15));
+    
+    return pFilter->output;
+}
+
+/**
+* <B> Function: MCAPP_MovingAvgFilterInit(&pFilter, scaler) </B>
 *
 * @brief Function to initialize moving average filter. 
 *        
-* @param none.
+* @param Pointer to the data structure containing variables for filter.
+* @param Filter gain is 1/2^scaler.
 * @return none.
 * 
 * @example
-* <CODE> MCAPP_MovingAvgFilterInit(input); </CODE>
+* <CODE> MCAPP_MovingAvgFilterInit(&pFilter, scaler); </CODE>
 *
 */
-void MCAPP_MovingAvgFilterInit (void)
+void MCAPP_MovingAvgFilterInit (MCAPP_FILTER_AVG_T *pFilter, uint16_t scaler)
 {
-    movingAvgFilter.accumalator = 0;
-    movingAvgFilter.mean = 0;
-    movingAvgFilter.average = 0;
+    pFilter->accumalator = 0;
+    pFilter->mean = 0;
+    pFilter->average = 0;
+    pFilter->scaler = scaler;
 }
 
 /**
-* <B> Function: MCAPP_MovingAvgFilter(input) </B>
+* <B> Function: MCAPP_MovingAvgFilter(&pFilter, input) </B>
 *
 * @brief Function to implement moving average filter. 
 *        
 * @param Pointer to the data structure containing variables for filter.
+* @param Filter input.
 * @return average filter output.
 * 
 * @example
-* <CODE> MCAPP_MovingAvgFilter(input); </CODE>
+* <CODE> MCAPP_MovingAvgFilter(&pFilter, input); </CODE>
+*
+*/
+int32_t MCAPP_MovingAvgFilter (MCAPP_FILTER_AVG_T *pFilter, int32_t input)
+{
+    pFilter->accumalator += input;
+    pFilter->mean = (int32_t)(pFilter->accumalator >> pFilter->scaler);
+    pFilter->accumalator -= pFilter->mean;
+    pFilter->average = pFilter->mean;
+    
+    return pFilter->average;
+}
+
+/**
+* <B> Function: MCAPP_WindowAvgFilterInit(&pFilter, pBuffer, size) </B>
+*
+* @brief Function to initialize windowed moving average filter. 
+*        
+* @param Pointer to the data structure containing variables for filter.
+* @param Buffer of window length to hold the samples.
+* @param Window length in samples.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_WindowAvgFilterInit(&pFilter, pBuffer, size); </CODE>
+*
+*/
+void MCAPP_WindowAvgFilterInit (MCAPP_FILTER_WINDOW_T *pFilter, 
+                                            int32_t *pBuffer, uint16_t size)
+{
+    pFilter->pBuffer = pBuffer;
+    pFilter->size = size;
+    pFilter->index = 0;
+    pFilter->count = 0;
+    pFilter->sum = 0;
+}
+
+/**
+* <B> Function: MCAPP_WindowAvgFilter(&pFilter, input) </B>
+*
+* @brief Function to implement windowed moving average filter, the oldest 
+*        sample is replaced by the input and the sum is updated with their
+*        difference. Until the window is filled, the average is taken over 
+*        the samples received.
+*        
+* @param Pointer to the data structure containing variables for filter.
+* @param Filter input.
+* @return average of the samples in the window.
+* 
+* @example
+* <CODE> MCAPP_WindowAvgFilter(&pFilter, input); </CODE>
+*
+*/
+int32_t MCAPP_WindowAvgFilter (MCAPP_FILTER_WINDOW_T *pFilter, int32_t input)
+{
+    if(pFilter->count < pFilter->size)
+    {
+        pFilter->count++;
+    }
+    else
+    {
+        pFilter->sum -= pFilter->pBuffer[pFilter->index];
+    }
+    pFilter->sum += input;
+    pFilter->pBuffer[pFilter->index] = input;
+    
+    pFilter->index++;
+    if(pFilter->index >= pFilter->size)
+    {
+        pFilter->index = 0;
+    }
+    
+    return (pFilter->sum / pFilter->count);
+}
+
+/**
+* <B> Function: MCAPP_MedianFilterInit(&pFilter, size) </B>
+*
+* @brief Function to initialize median filter. 
+*        
+* @param Pointer to the data structure containing variables for filter.
+* @param Number of samples, odd, from 1 up to FILTER_MEDIAN_SIZE_MAX.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MedianFilterInit(&pFilter, size); </CODE>
+*
+*/
+void MCAPP_MedianFilterInit (MCAPP_FILTER_MEDIAN_T *pFilter, uint16_t size)
+{
+    if(size > FILTER_MEDIAN_SIZE_MAX)
+    {
+        size = FILTER_MEDIAN_SIZE_MAX;
+    }
+    else if(size == 0)
+    {
+        size = 1;
+    }
+    if((size & 1) == 0)
+    {
+        size = size - 1;
+    }
+    pFilter->size = size;
+    pFilter->index = 0;
+    pFilter->count = 0;
+}
+
+/**
+* <B> Function: MCAPP_MedianFilter(&pFilter, input) </B>
+*
+* @brief Function to implement median filter, a single outlier in the 
+*        samples does not appear in the output.
+*        
+* @param Pointer to the data structure containing variables for filter.
+* @param Filter input.
+* @return median of the last samples.
+* 
+* @example
+* <CODE> MCAPP_MedianFilter(&pFilter, input); </CODE>
+*
+*/
+float MCAPP_MedianFilter (MCAPP_FILTER_MEDIAN_T *pFilter, float input)
+{
+    float sorted[FILTER_MEDIAN_SIZE_MAX], sample;
+    uint16_t i, j;
+    
+    pFilter->buffer[pFilter->index] = input;
+    pFilter->index++;
+    if(pFilter->index >= pFilter->size)
+    {
+        pFilter->index = 0;
+    }
+    if(pFilter->count < pFilter->size)
+    {
+        pFilter->count++;
+    }
+    
+    /* Insertion sort of the samples received */
+    for(i = 0; i < pFilter->count; i++)
+    {
+        sample = pFilter->buffer[i];
+        j = i;
+        while((j > 0) && (sorted[j - 1] > sample))
+        {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = sample;
+    }
+    
+    return sorted[pFilter->count >> 1];
+}
+
+/**
+* <B> Function: MCAPP_BiquadFilterReset(&pFilter) </B>
+*
+* @brief Function to reset the state of a biquad filter, the coefficients 
+*        are set by the initializer FILTER_BIQUAD_LPF. 
+*        
+* @param Pointer to the data structure containing variables for filter.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_BiquadFilterReset(&pFilter); </CODE>
+*
+*/
+void MCAPP_BiquadFilterReset (MCAPP_FILTER_BIQUAD_T *pFilter)
+{
+    pFilter->z1 = 0;
+    pFilter->z2 = 0;
+}
+
+/**
+* <B> Function: MCAPP_BiquadFilter(&pFilter, input) </B>
+*
+* @brief Function to implement biquad filter in direct form II transposed. 
+*        
+* @param Pointer to the data structure containing variables for filter.
+* @param Filter input.
+* @return filtered output.
+* 
+* @example
+* <CODE> MCAPP_BiquadFilter(&pFilter, input); </CODE>
+*
+*/
+float MCAPP_BiquadFilter (MCAPP_FILTER_BIQUAD_T *pFilter, float input)
+{
+    float output;
+    
+    output = (pFilter->b0 * input) + pFilter->z1;
+    pFilter->z1 = (pFilter->b1 * input) - (pFilter->a1 * output) + pFilter->z2;
+    pFilter->z2 = (pFilter->b2 * input) - (pFilter->a2 * output);
+    
+    return output;
+}
+
+/**
+* <B> Function: MCAPP_BiquadCascadeInit(&pFilter, pStage, stages) </B>
+*
+* @brief Function to initialize a cascade of biquad filters and reset the 
+*        state of each section. 
+*        
+* @param Pointer to the data structure containing variables for filter.
+* @param Array of second order sections.
+* @param Number of second order sections.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_BiquadCascadeInit(&pFilter, pStage, stages); </CODE>
+*
+*/
+void MCAPP_BiquadCascadeInit (MCAPP_FILTER_BIQUAD_CASCADE_T *pFilter, 
+                            MCAPP_FILTER_BIQUAD_T *pStage, uint16_t stages)
+{
+    uint16_t stage;
+    
+    pFilter->pStage = pStage;
+    pFilter->stages = stages;
+    pFilter->output = 0;
+    for(stage = 0; stage < stages; stage++)
+    {
+        MCAPP_BiquadFilterReset(&pStage[stage]);
+    }
+}
+
+/**
+* <B> Function: MCAPP_BiquadCascadeFilter(&pFilter, input) </B>
+*
+* @brief Function to implement a cascade of biquad filters. 
+*        
+* @param Pointer to the data structure containing variables for filter.
+* @param Filter input.
+* @return filtered output.
+* 
+* @example
+* <CODE> MCAPP_BiquadCascadeFilter(&pFilter, input); </CODE>
 *
 */
-int32_t MCAPP_MovingAvgFilter (int32_t input)
+float MCAPP_BiquadCascadeFilter (MCAPP_FILTER_BIQUAD_CASCADE_T *pFilter, 
+                                                                float input)
 {
-    movingAvgFilter.accumalator += input;
-    movingAvgFilter.mean = (int32_t)(movingAvgFilter.accumalator >> AVGFILTER_SCALER);
-    movingAvgFilter.accumalator -= movingAvgFilter.mean;
-    movingAvgFilter.average = movingAvgFilter.mean;
+    uint16_t stage;
+    
+    for(stage = 0; stage < pFilter->stages; stage++)
+    {
+        input = MCAPP_BiquadFilter(&pFilter->pStage[stage], input);
+    }
+    pFilter->output = input;
+    
+    return pFilter->output;
+}
+
+/**
+* <B> Function: MCAPP_BiquadFilterQ15Reset(&pFilter) </B>
+*
+* @brief Function to reset the state of a Q15 biquad filter, the 
+*        coefficients are set by the initializer FILTER_BIQUAD_LPF_Q15. 
+*        
+* @param Pointer to the data structure containing variables for filter.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_BiquadFilterQ15Reset(&pFilter); </CODE>
+*
+*/
+void MCAPP_BiquadFilterQ15Reset (MCAPP_FILTER_BIQUAD_Q15_T *pFilter)
+{
+    pFilter->x1 = 0;
+    pFilter->x2 = 0;
+    pFilter->y1 = 0;
+    pFilter->y2 = 0;
+}
+
+/**
+* <B> Function: MCAPP_BiquadFilterQ15(&pFilter, input) </B>
+*
+* @brief Function to implement biquad filter in direct form I, the products 
+*        are accumulated in 32 bit and the output is saturated to Q15. 
+*        
+* @param Pointer to the data structure containing variables for filter.
+* @param Filter input in Q15.
+* @return filtered output in Q15.
+* 
+* @example
+* <CODE> MCAPP_BiquadFilterQ15(&pFilter, input); </CODE>
+*
+*/
+int16_t MCAPP_BiquadFilterQ15 (MCAPP_FILTER_BIQUAD_Q15_T *pFilter, 
+                                                                int16_t input)
+{
+    int32_t accumulator;
+    
+    accumulator = ((int32_t)pFilter->b0 * input) + 
+                  ((int32_t)pFilter->b1 * pFilter->x1) +
+                  ((int32_t)pFilter->b2 * pFilter->x2) -
+                  ((int32_t)pFilter->a1 * pFilter->y1) -
+                  ((int32_t)pFilter->a2 * pFilter->y2);
+    accumulator = accumulator >> 14;
+    if(accumulator > INT16_MAX)
+    {
+        accumulator = INT16_MAX;
+    }
+    else if(accumulator < INT16_MIN)
+    {
+        accumulator = INT16_MIN;
+    }
+    
+    pFilter->x2 = pFilter->x1;
+    pFilter->x1 = input;
+    pFilter->y2 = pFilter->y1;
+    pFilter->y1 = (int16_t)accumulator;
     
-    return movingAvgFilter.average;
+    return pFilter->y1;
 }
 
 // </editor-fold> 
\ No newline at end of file
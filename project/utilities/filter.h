@@ -49,16 +49,79 @@ extern "C" {
 #include "filter_types.h"
 // </editor-fold>
 // <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
-/* Cut-off frequency for Low pass filter */    
-#define LFP_CUTOFF_FREQUENCY 0.1
 #define AVGFILTER_SCALER  4
+
+#define FILTER_PI         3.14159265f
+
+/* Conversion of a coefficient to Q15 and Q14 format */
+#define FILTER_Q15(x)     (int16_t)((x) * 32767.0f)
+#define FILTER_Q14(x)     (int16_t)((x) * 16384.0f)
+
+/* Tangent by its Taylor series, accurate for arguments up to pi/4 (cut-off 
+   frequency up to a quarter of the sample frequency). Unlike tanf() it is
+   a constant expression and can be used in initializers */
+#define FILTER_TAN(x)     ((x) + (((x)*(x)*(x))/3.0f) + \
+                          ((2.0f*(x)*(x)*(x)*(x)*(x))/15.0f) + \
+                          ((17.0f*(x)*(x)*(x)*(x)*(x)*(x)*(x))/315.0f))
+
+/* First order low pass filter coefficient from the cut-off frequency and the
+   sample frequency (Hz) */
+#define FILTER_LPF_WC(fc, fs)   (2.0f * FILTER_PI * (fc) / (fs))
+#define FILTER_LPF_COEFF(fc, fs) \
+                    (FILTER_LPF_WC(fc, fs) / (1.0f + FILTER_LPF_WC(fc, fs)))
+
+/* Second order low pass filter coefficients from the cut-off frequency, the 
+   sample frequency (Hz) and the quality factor (0.7071 = Butterworth), by 
+   bilinear transform with frequency pre-warping */
+#define FILTER_BIQUAD_K(fc, fs)         FILTER_TAN(FILTER_PI * (fc) / (fs))
+#define FILTER_BIQUAD_NORM(fc, fs, q)   (1.0f / (1.0f + \
+                    (FILTER_BIQUAD_K(fc, fs) / (q)) + \
+                    (FILTER_BIQUAD_K(fc, fs) * FILTER_BIQUAD_K(fc, fs))))
+#define FILTER_BIQUAD_LPF_B0(fc, fs, q) (FILTER_BIQUAD_K(fc, fs) * \
+                    FILTER_BIQUAD_K(fc, fs) * FILTER_BIQUAD_NORM(fc, fs, q))
+#define FILTER_BIQUAD_LPF_B1(fc, fs, q) (2.0f * FILTER_BIQUAD_LPF_B0(fc, fs, q))
+#define FILTER_BIQUAD_LPF_B2(fc, fs, q) FILTER_BIQUAD_LPF_B0(fc, fs, q)
+#define FILTER_BIQUAD_LPF_A1(fc, fs, q) (2.0f * ((FILTER_BIQUAD_K(fc, fs) * \
+                    FILTER_BIQUAD_K(fc, fs)) - 1.0f) * FILTER_BIQUAD_NORM(fc, fs, q))
+#define FILTER_BIQUAD_LPF_A2(fc, fs, q) ((1.0f - (FILTER_BIQUAD_K(fc, fs) / (q)) + \
+                    (FILTER_BIQUAD_K(fc, fs) * FILTER_BIQUAD_K(fc, fs))) * \
+                    FILTER_BIQUAD_NORM(fc, fs, q))
+
+/* Initializer of a low pass MCAPP_FILTER_BIQUAD_T */
+#define FILTER_BIQUAD_LPF(fc, fs, q)   { FILTER_BIQUAD_LPF_B0(fc, fs, q), \
+                    FILTER_BIQUAD_LPF_B1(fc, fs, q), FILTER_BIQUAD_LPF_B2(fc, fs, q), \
+                    FILTER_BIQUAD_LPF_A1(fc, fs, q), FILTER_BIQUAD_LPF_A2(fc, fs, q), \
+                    0.0f, 0.0f }
+/* Initializer of a low pass MCAPP_FILTER_BIQUAD_Q15_T, the numerator 
+   coefficients lose resolution for cut-off frequencies below fs/100 */
+#define FILTER_BIQUAD_LPF_Q15(fc, fs, q)   { \
+                    FILTER_Q14(FILTER_BIQUAD_LPF_B0(fc, fs, q)), \
+                    FILTER_Q14(FILTER_BIQUAD_LPF_B1(fc, fs, q)), \
+                    FILTER_Q14(FILTER_BIQUAD_LPF_B2(fc, fs, q)), \
+                    FILTER_Q14(FILTER_BIQUAD_LPF_A1(fc, fs, q)), \
+                    FILTER_Q14(FILTER_BIQUAD_LPF_A2(fc, fs, q)), \
+                    0, 0, 0, 0 }
 // </editor-fold> 
     
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
 
-float MCAPP_LowPassFilter (float);
-void MCAPP_MovingAvgFilterInit (void);
-int32_t MCAPP_MovingAvgFilter (int32_t);
+void MCAPP_LowPassFilterInit (MCAPP_FILTER_LPF_T *, float);
+float MCAPP_LowPassFilter (MCAPP_FILTER_LPF_T *, float);
+void MCAPP_LowPassFilterQ15Init (MCAPP_FILTER_LPF_Q15_T *, int16_t);
+int16_t MCAPP_LowPassFilterQ15 (MCAPP_FILTER_LPF_Q15_T *, int16_t);
+void MCAPP_MovingAvgFilterInit (MCAPP_FILTER_AVG_T *, uint16_t);
+int32_t MCAPP_MovingAvgFilter (MCAPP_FILTER_AVG_T *, int32_t);
+void MCAPP_WindowAvgFilterInit (MCAPP_FILTER_WINDOW_T *, int32_t *, uint16_t);
+int32_t MCAPP_WindowAvgFilter (MCAPP_FILTER_WINDOW_T *, int32_t);
+void MCAPP_MedianFilterInit (MCAPP_FILTER_MEDIAN_T *, uint16_t);
+float MCAPP_MedianFilter (MCAPP_FILTER_MEDIAN_T *, float);
+void MCAPP_BiquadFilterReset (MCAPP_FILTER_BIQUAD_T *);
+float MCAPP_BiquadFilter (MCAPP_FILTER_BIQUAD_T *, float);
+void MCAPP_BiquadCascadeInit (MCAPP_FILTER_BIQUAD_CASCADE_T *, 
+                                        MCAPP_FILTER_BIQUAD_T *, uint16_t);
+float MCAPP_BiquadCascadeFilter (MCAPP_FILTER_BIQUAD_CASCADE_T *, float);
+void MCAPP_BiquadFilterQ15Reset (MCAPP_FILTER_BIQUAD_Q15_T *);
+int16_t MCAPP_BiquadFilterQ15 (MCAPP_FILTER_BIQUAD_Q15_T *, int16_t);
 
 // </editor-fold> 
 
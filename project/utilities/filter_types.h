@@ -42,6 +42,19 @@
 extern "C" {
 #endif
 
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS/CONSTANTS ">
+
+/* Maximum number of samples of the median filter */
+#define FILTER_MEDIAN_SIZE_MAX  7
+
+// </editor-fold>
+
 // <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
     
 /**
@@ -49,9 +62,19 @@ extern "C" {
 */
 typedef struct
 {
+    float coefficient;   /* Filter coefficient, see FILTER_LPF_COEFF */
     float output;        /* Output of LPF */
 }MCAPP_FILTER_LPF_T;
 
+/**
+ * Low pass filter data type, Q15 format
+*/
+typedef struct
+{
+    int16_t coefficient; /* Filter coefficient in Q15 */
+    int16_t output;      /* Output of LPF */
+}MCAPP_FILTER_LPF_Q15_T;
+
 /**
  * Moving average filter data type
 */
@@ -60,7 +83,64 @@ typedef struct
     int32_t mean;           /* mean value */
     int32_t average;        /* average filtered data */
     int32_t accumalator;    /*Variable to accumulate previous output */
+    uint16_t scaler;        /* Filter gain is 1/2^scaler */
 }MCAPP_FILTER_AVG_T;
+
+/**
+ * Windowed moving average filter data type, the buffer holding the window
+ * is provided by the user
+*/
+typedef struct
+{
+    int32_t *pBuffer;       /* Samples in the window */
+    int32_t sum;            /* Sum of the samples in the window */
+    uint16_t size;          /* Window length in samples */
+    uint16_t index;         /* Position of the oldest sample */
+    uint16_t count;         /* Samples received, up to window length */
+}MCAPP_FILTER_WINDOW_T;
+
+/**
+ * Median filter data type
+*/
+typedef struct
+{
+    float buffer[FILTER_MEDIAN_SIZE_MAX];   /* Last samples received */
+    uint16_t size;          /* Number of samples, odd */
+    uint16_t index;         /* Position of the oldest sample */
+    uint16_t count;         /* Samples received, up to size */
+}MCAPP_FILTER_MEDIAN_T;
+
+/**
+ * Biquad (second order section) data type, direct form II transposed
+ * y = b0.x + z1, z1 = b1.x - a1.y + z2, z2 = b2.x - a2.y
+*/
+typedef struct
+{
+    float b0, b1, b2;       /* Numerator coefficients */
+    float a1, a2;           /* Denominator coefficients, a0 = 1 */
+    float z1, z2;           /* State */
+}MCAPP_FILTER_BIQUAD_T;
+
+/**
+ * Cascade of biquads data type
+*/
+typedef struct
+{
+    MCAPP_FILTER_BIQUAD_T *pStage;  /* Array of second order sections */
+    uint16_t stages;                /* Number of second order sections */
+    float output;                   /* Output of the last section */
+}MCAPP_FILTER_BIQUAD_CASCADE_T;
+
+/**
+ * Biquad data type, Q15 format with Q14 coefficients, direct form I
+*/
+typedef struct
+{
+    int16_t b0, b1, b2;     /* Numerator coefficients in Q14 */
+    int16_t a1, a2;         /* Denominator coefficients in Q14, a0 = 1 */
+    int16_t x1, x2;         /* Previous inputs */
+    int16_t y1, y2;         /* Previous outputs */
+}MCAPP_FILTER_BIQUAD_Q15_T;
   
 // </editor-fold>
 #ifdef	__cplusplus
@@ -0,0 +1,139 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * scheduler.c
+ *
+ * This file implements the multi-rate task scheduler. Every slot counts down 
+ * the ticks to its next execution, no division is needed on the tick.
+ *
+ *
+ * Component: UTILITIES
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "scheduler.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_SchedulerInit(&pScheduler, pSlot, pStatus, slots, 
+*                                                   pTimeRead, pContext) </B>
+*
+* @brief Function to initialize the scheduler with its static task table, 
+*        the first execution of each slot is at the tick of its phase.
+*
+* @param Pointer to the data structure containing scheduler parameters.
+* @param Static task table.
+* @param Status of each slot of the table.
+* @param Number of slots of the table.
+* @param Function reading the free running timer of the execution time.
+* @param Context passed to the tasks.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_SchedulerInit(&pScheduler, slot, status, 3, timerRead, 
+*                                                           &context); </CODE>
+*
+*/
+void MCAPP_SchedulerInit(MCAPP_SCHEDULER_T *pScheduler, 
+        const MCAPP_SCHEDULER_SLOT_T *pSlot, MCAPP_SCHEDULER_STATUS_T *pStatus,
+        uint16_t slots, uint32_t (*pTimeRead)(void), void *pContext)
+{
+    uint16_t index;
+
+    pScheduler->pSlot = pSlot;
+    pScheduler->pStatus = pStatus;
+    pScheduler->slots = slots;
+    pScheduler->pTimeRead = pTimeRead;
+    pScheduler->pContext = pContext;
+    pScheduler->overrunCount = 0;
+    
+    for(index = 0; index < slots; index++)
+    {
+        pStatus[index].countdown = pSlot[index].phase;
+        pStatus[index].time = 0;
+        pStatus[index].timeMax = 0;
+        pStatus[index].overrunCount = 0;
+        pStatus[index].overrun = 0;
+    }
+}
+
+/**
+* <B> Function: MCAPP_SchedulerTick(&pScheduler) </B>
+*
+* @brief Function executed every control loop to run the tasks due on this 
+*        tick in table order, measure their execution time and count the 
+*        executions longer than the budget of the slot.
+*
+* @param Pointer to the data structure containing scheduler parameters.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_SchedulerTick(&pScheduler); </CODE>
+*
+*/
+void MCAPP_SchedulerTick(MCAPP_SCHEDULER_T *pScheduler)
+{
+    const MCAPP_SCHEDULER_SLOT_T *pSlot = pScheduler->pSlot;
+    MCAPP_SCHEDULER_STATUS_T *pStatus = pScheduler->pStatus;
+    uint16_t index;
+    uint32_t start, time;
+
+    for(index = 0; index < pScheduler->slots; index++, pSlot++, pStatus++)
+    {
+        if(pStatus->countdown > 0)
+        {
+            pStatus->countdown--;
+            continue;
+        }
+        pStatus->countdown = pSlot->divider - 1;
+        
+        start = pScheduler->pTimeRead();
+        pSlot->task(pScheduler->pContext);
+        time = pScheduler->pTimeRead() - start;
+        
+        pStatus->time = time;
+        if(time > pStatus->timeMax)
+        {
+            pStatus->timeMax = time;
+        }
+        pStatus->overrun = (time > pSlot->budget);
+        if(pStatus->overrun == 1)
+        {
+            pStatus->overrunCount++;
+            pScheduler->overrunCount++;
+        }
+    }
+}
+
+// </editor-fold>
@@ -0,0 +1,106 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file scheduler_types.h
+ *
+ * @brief This module initializes data structure variable type definitions of
+ * the multi-rate task scheduler structure
+ *
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef SCHEDULER_TYPES_H
+#define	SCHEDULER_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+#include <stdbool.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+/* Task executed in a slot, called with the context of the scheduler */
+typedef void (*MCAPP_SCHEDULER_TASK_T)(void *);
+
+/**
+ * Slot of the static task table. The task is executed on the ticks where the
+ * tick count modulo the divider equals the phase, slow slots with different
+ * phases are executed on different ticks.
+*/
+typedef struct
+{
+    MCAPP_SCHEDULER_TASK_T
+        task;               /* Task of the slot */
+    uint16_t
+        divider,            /* Ticks per execution, 1 = every tick */
+        phase;              /* Tick of the execution, 0 to divider - 1 */
+    uint32_t
+        budget;             /* Execution time budget in timer counts */
+}MCAPP_SCHEDULER_SLOT_T;
+
+typedef struct
+{
+    uint16_t
+        countdown;          /* Ticks till the next execution */
+    uint32_t
+        time,               /* Last execution time in timer counts */
+        timeMax,            /* Longest execution time in timer counts */
+        overrunCount;       /* Executions longer than the budget */
+    bool
+        overrun;            /* Last execution longer than the budget */
+}MCAPP_SCHEDULER_STATUS_T;
+
+typedef struct
+{
+    const MCAPP_SCHEDULER_SLOT_T
+        *pSlot;             /* Static task table */
+    MCAPP_SCHEDULER_STATUS_T
+        *pStatus;           /* Status of each slot of the table */
+    uint32_t
+        (*pTimeRead)(void); /* Free running timer of the execution time */
+    void
+        *pContext;          /* Context passed to the tasks */
+    uint16_t
+        slots;              /* Number of slots of the table */
+    uint32_t
+        overrunCount;       /* Executions longer than the budget, all slots */
+}MCAPP_SCHEDULER_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* SCHEDULER_TYPES_H */
+
@@ -0,0 +1,260 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * state_engine.c
+ *
+ * This file implements the table driven state engine. The transitions of 
+ * each state are located through an index built at initialization, a tick 
+ * evaluates only the fault check and the guards of the present state.
+ *
+ *
+ * Component: UTILITIES
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Header Files ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "state_engine.h"
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+static void MCAPP_StateEngineTransition(MCAPP_STATE_ENGINE_T *, uint16_t, 
+                                                        uint16_t, uint16_t);
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_StateEngineInit(&pEngine, pHandlers, states, 
+*                       pTransition, transitions, pState, pContext) </B>
+*
+* @brief Function to initialize the state engine and index the transition 
+*        table, which has to be sorted by the state left. The fault check is
+*        set with MCAPP_StateEngineFaultSet and the engine is started with 
+*        MCAPP_StateEngineStart.
+*
+* @param Pointer to the data structure containing state engine parameters.
+* @param Actions of each state, indexed by state.
+* @param Number of states, STATE_ENGINE_STATES_MAX at most.
+* @param Transition table sorted by the state left.
+* @param Number of transitions of the table.
+* @param Pointer for the present state.
+* @param Context passed to the actions and guards.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_StateEngineInit(&pEngine, handlers, 8, transitions, 9, 
+*                                                   &state, &context); </CODE>
+*
+*/
+void MCAPP_StateEngineInit(MCAPP_STATE_ENGINE_T *pEngine, 
+        const MCAPP_STATE_HANDLERS_T *pHandlers, uint16_t states, 
+        const MCAPP_STATE_TRANSITION_T *pTransition, uint16_t transitions, 
+        uint16_t *pState, void *pContext)
+{
+    uint16_t state, index = 0;
+
+    pEngine->pHandlers = pHandlers;
+    pEngine->states = states;
+    pEngine->pTransition = pTransition;
+    pEngine->pState = pState;
+    pEngine->pContext = pContext;
+    pEngine->faultCheck = NULL;
+    pEngine->fault = 0;
+    pEngine->tick = 0;
+    pEngine->transitionCount = 0;
+    pEngine->traceIndex = 0;
+    
+    for(state = 0; state <= states; state++)
+    {
+        while((index < transitions) && (pTransition[index].from < state))
+        {
+            index++;
+        }
+        pEngine->firstTransition[state] = index;
+    }
+    pEngine->firstTransition[states] = transitions;
+}
+
+/**
+* <B> Function: MCAPP_StateEngineFaultSet(&pEngine, faultCheck, faultState,
+*                                                       faultCause) </B>
+*
+* @brief Function to set the fault check evaluated before the transitions 
+*        every tick, a fault enters the fault state from any other state.
+*
+* @param Pointer to the data structure containing state engine parameters.
+* @param Fault check, returns the fault code or 0.
+* @param State entered on a fault.
+* @param Cause recorded for a fault transition.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_StateEngineFaultSet(&pEngine, faultCheck, 6, 5); </CODE>
+*
+*/
+void MCAPP_StateEngineFaultSet(MCAPP_STATE_ENGINE_T *pEngine, 
+        MCAPP_STATE_FAULT_CHECK_T faultCheck, uint16_t faultState, 
+                                                        uint16_t faultCause)
+{
+    pEngine->faultCheck = faultCheck;
+    pEngine->faultState = faultState;
+    pEngine->faultCause = faultCause;
+}
+
+/**
+* <B> Function: MCAPP_StateEngineStart(&pEngine, state) </B>
+*
+* @brief Function to enter the initial state, its entry action is executed.
+*
+* @param Pointer to the data structure containing state engine parameters.
+* @param Initial state.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_StateEngineStart(&pEngine, 0); </CODE>
+*
+*/
+void MCAPP_StateEngineStart(MCAPP_STATE_ENGINE_T *pEngine, uint16_t state)
+{
+    *pEngine->pState = state;
+    if(pEngine->pHandlers[state].entry != NULL)
+    {
+        pEngine->pHandlers[state].entry(pEngine->pContext);
+    }
+}
+
+/**
+* <B> Function: MCAPP_StateEngineStep(&pEngine) </B>
+*
+* @brief Function executed every tick :
+*        (1) Outside the fault state, the fault check enters the fault state
+*        (2) Otherwise the first transition of the present state with its 
+*            guard true is taken
+*        (3) The step action of the resulting state is executed
+*
+* @param Pointer to the data structure containing state engine parameters.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_StateEngineStep(&pEngine); </CODE>
+*
+*/
+void MCAPP_StateEngineStep(MCAPP_STATE_ENGINE_T *pEngine)
+{
+    const MCAPP_STATE_TRANSITION_T *pTransition;
+    uint16_t state = *pEngine->pState, index, last, fault = 0;
+
+    pEngine->tick++;
+    
+    if((state != pEngine->faultState) && (pEngine->faultCheck != NULL))
+    {
+        fault = pEngine->faultCheck(pEngine->pContext);
+    }
+    
+    if(fault != 0)
+    {
+        pEngine->fault = fault;
+        MCAPP_StateEngineTransition(pEngine, pEngine->faultState, 
+                                                pEngine->faultCause, fault);
+    }
+    else
+    {
+        last = pEngine->firstTransition[state + 1];
+        for(index = pEngine->firstTransition[state]; index < last; index++)
+        {
+            pTransition = &pEngine->pTransition[index];
+            if((pTransition->guard == NULL) || 
+                            (pTransition->guard(pEngine->pContext) == 1))
+            {
+                MCAPP_StateEngineTransition(pEngine, pTransition->to, 
+                                                    pTransition->cause, 0);
+                break;
+            }
+        }
+    }
+    
+    state = *pEngine->pState;
+    if(pEngine->pHandlers[state].step != NULL)
+    {
+        pEngine->pHandlers[state].step(pEngine->pContext);
+    }
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_StateEngineTransition(&pEngine, to, cause, fault) </B>
+*
+* @brief Function to leave the present state, record the transition in the 
+*        trace and enter the next state.
+*
+* @param Pointer to the data structure containing state engine parameters.
+* @param State entered.
+* @param Cause of the transition.
+* @param Fault code of a fault transition, else 0.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_StateEngineTransition(&pEngine, 3, 1, 0); </CODE>
+*
+*/
+static void MCAPP_StateEngineTransition(MCAPP_STATE_ENGINE_T *pEngine, 
+                                uint16_t to, uint16_t cause, uint16_t fault)
+{
+    uint16_t from = *pEngine->pState;
+    MCAPP_STATE_TRACE_T *pTrace = &pEngine->trace[pEngine->traceIndex];
+
+    if(pEngine->pHandlers[from].exit != NULL)
+    {
+        pEngine->pHandlers[from].exit(pEngine->pContext);
+    }
+    
+    pTrace->timestamp = pEngine->tick;
+    pTrace->from = from;
+    pTrace->to = to;
+    pTrace->cause = cause;
+    pTrace->fault = fault;
+    pEngine->traceIndex = 
+                (pEngine->traceIndex + 1) & (STATE_ENGINE_TRACE_SIZE - 1);
+    pEngine->transitionCount++;
+    
+    *pEngine->pState = to;
+    if(pEngine->pHandlers[to].entry != NULL)
+    {
+        pEngine->pHandlers[to].entry(pEngine->pContext);
+    }
+}
+
+// </editor-fold>
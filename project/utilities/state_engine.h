@@ -0,0 +1,75 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file state_engine.h
+ *
+ * @brief This header file lists interface functions of the table driven 
+ * state engine.
+ *
+ * Note : Every tick the fault check is evaluated first, a fault enters the 
+ * fault state directly. Otherwise the guards of the transitions leaving the
+ * present state are evaluated in table order and the first transition with
+ * its guard true is taken. The step action of the resulting state is 
+ * executed last. Every transition is recorded in a trace ring buffer.
+ *
+ * Component: UTILITIES
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef STATE_ENGINE_H
+#define	STATE_ENGINE_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "state_engine_types.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+void MCAPP_StateEngineInit(MCAPP_STATE_ENGINE_T *, 
+            const MCAPP_STATE_HANDLERS_T *, uint16_t, 
+            const MCAPP_STATE_TRANSITION_T *, uint16_t, uint16_t *, void *);
+void MCAPP_StateEngineFaultSet(MCAPP_STATE_ENGINE_T *, 
+                            MCAPP_STATE_FAULT_CHECK_T, uint16_t, uint16_t);
+void MCAPP_StateEngineStart(MCAPP_STATE_ENGINE_T *, uint16_t);
+void MCAPP_StateEngineStep(MCAPP_STATE_ENGINE_T *);
+
+// </editor-fold>
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* STATE_ENGINE_H */
+
@@ -0,0 +1,135 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file state_engine_types.h
+ *
+ * @brief This module initializes data structure variable type definitions of
+ * the table driven state engine structure
+ *
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef STATE_ENGINE_TYPES_H
+#define	STATE_ENGINE_TYPES_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+#include <stdint.h>
+#include <stdbool.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Largest number of states of a state engine */
+#define STATE_ENGINE_STATES_MAX     16
+/* Number of transitions kept in the trace, power of 2 */
+#define STATE_ENGINE_TRACE_SIZE     16
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
+
+/* Entry, step or exit action of a state, called with the context */
+typedef void (*MCAPP_STATE_ACTION_T)(void *);
+/* Guard of a transition, the transition is taken when it returns 1 */
+typedef bool (*MCAPP_STATE_GUARD_T)(void *);
+/* Fault check, returns the fault code or 0 if there is no fault */
+typedef uint16_t (*MCAPP_STATE_FAULT_CHECK_T)(void *);
+
+/**
+ * Actions of a state, an action not needed is NULL. The entry and exit 
+ * actions are executed once on a transition, the step action every tick.
+*/
+typedef struct
+{
+    MCAPP_STATE_ACTION_T
+        entry,              /* Action on entering the state */
+        step,               /* Action every tick in the state */
+        exit;               /* Action on leaving the state */
+}MCAPP_STATE_HANDLERS_T;
+
+typedef struct
+{
+    uint16_t
+        from;               /* State the transition leaves */
+    MCAPP_STATE_GUARD_T
+        guard;              /* Condition of the transition, NULL = always */
+    uint16_t
+        to,                 /* State the transition enters */
+        cause;              /* Cause recorded in the trace */
+}MCAPP_STATE_TRANSITION_T;
+
+typedef struct
+{
+    uint32_t
+        timestamp;          /* Tick of the transition */
+    uint16_t
+        from,               /* State left */
+        to,                 /* State entered */
+        cause,              /* Cause of the transition */
+        fault;              /* Fault code of a fault transition, else 0 */
+}MCAPP_STATE_TRACE_T;
+
+typedef struct
+{
+    const MCAPP_STATE_HANDLERS_T
+        *pHandlers;         /* Actions of each state, indexed by state */
+    const MCAPP_STATE_TRANSITION_T
+        *pTransition;       /* Transition table sorted by the state left */
+    MCAPP_STATE_FAULT_CHECK_T
+        faultCheck;         /* Fault check evaluated before the transitions */
+    void
+        *pContext;          /* Context passed to the actions and guards */
+    uint16_t
+        *pState,            /* Present state */
+        states,             /* Number of states */
+        faultState,         /* State entered on a fault */
+        faultCause,         /* Cause recorded for a fault transition */
+        fault,              /* Fault code of the last fault transition */
+        firstTransition[STATE_ENGINE_STATES_MAX + 1], /* First transition 
+                               of each state in the transition table */
+        traceIndex;         /* Next entry of the trace */
+    uint32_t
+        tick,               /* Ticks since initialization */
+        transitionCount;    /* Transitions since initialization */
+    MCAPP_STATE_TRACE_T
+        trace[STATE_ENGINE_TRACE_SIZE]; /* Last transitions */
+}MCAPP_STATE_ENGINE_T;
+
+// </editor-fold>
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* STATE_ENGINE_TYPES_H */
+
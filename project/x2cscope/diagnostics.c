@@ -52,6 +52,7 @@
 
 #include "X2CScope.h"
 #include "uart1.h"
+#include "measure.h"
 
 // </editor-fold>
 
@@ -61,6 +62,11 @@
 #define X2C_BAUDRATE_DIVIDER 54 /** 100M/(16*54) = 115.7 kbps */
 #define X2C_BUFFER_SIZE 4900
 X2C_DATA static uint8_t X2C_BUFFER[X2C_BUFFER_SIZE];
+/* Measured signals converted to actual values for X2C Scope, bit mask of 
+   MEASURE_SIGNAL_xxx in measure.h. All the actual values are converted by
+   default; clear the bits of the values not watched from the X2C Scope watch
+   view to save the conversion time in the control loop */
+volatile uint16_t diagnosticsMeasureSignals = MEASURE_SIGNAL_ALL;
     /*
      * UART uses Clock Module #8 (100MHz)
      * baud rate = 100MHz/16/(1+baudrate_divider) for highspeed = false
@@ -150,6 +156,22 @@ void DiagnosticsStepIsr(void)
     X2CScope_Update();
 }
 /**
+* <B> Function: DiagnosticsMeasureSignalsGet() </B>
+*
+* @brief Function to read the measured signals requested by X2C Scope
+*        
+* @param none.
+* @return bit mask of measured signals.
+* 
+* @example
+* <CODE> DiagnosticsMeasureSignalsGet(); </CODE>
+*
+*/
+uint16_t DiagnosticsMeasureSignalsGet(void)
+{
+    return diagnosticsMeasureSignals;
+}
+/**
 * <B> Function: X2CScope_sendSerial() </B>
 *
 * @brief Function to write data through UART transmission
@@ -48,6 +48,8 @@
 #ifndef __DIAGNOSTICS_H
 #define __DIAGNOSTICS_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -70,6 +72,11 @@ void DiagnosticsStepIsr(void);
  * Executes diagnostic tasks during the main loop
  */
 void DiagnosticsStepMain(void);
+
+/**
+ * Returns the measured signals to be converted to actual values for X2C Scope
+ */
+uint16_t DiagnosticsMeasureSignalsGet(void);
 // </editor-fold>
 
 #ifdef __cplusplus